@@ -15,19 +15,230 @@
 
 # include "spatial.h"
 
-/* Internal BVH lifecycle functions */
-void		bvh_node_destroy(t_bvh_node *node);
+/* Wide BVH collapse state: output arrays and fill positions */
+typedef struct s_collapse
+{
+	t_bvh	*bvh;
+	int		width;
+	int		nodes;
+	int		refs;
+}	t_collapse;
+
+/*
+** Wide BVH traversal state: ray, closest hit and pending children.
+** lane_bit: mailbox lane of the ray (1 << lane inside a packet)
+*/
+typedef struct s_wide_trav
+{
+	t_bvh			*bvh;
+	int				lane_bit;
+	t_ray			ray;
+	t_wide_ray		wr;
+	t_hit_record	*hit;
+	void			*scene;
+	t_wide_entry	stack[BVH_WIDE_STACK];
+	int				size;
+}	t_wide_trav;
+
+/* Primary packet traversal state: per-lane slab rays, pending children */
+typedef struct s_packet_trav
+{
+	t_bvh			*bvh;
+	t_ray_packet	*packet;
+	t_wide_ray		wr[PACKET_LANES];
+	void			*scene;
+	t_wide_entry	stack[BVH_WIDE_STACK];
+	int				size;
+}	t_packet_trav;
+
+/* Children of one wide node seen by a packet: nearest entry, lane mask */
+typedef struct s_packet_kids
+{
+	t_real	tnear[BVH_WIDE_MAX];
+	int		mask[BVH_WIDE_MAX];
+}	t_packet_kids;
+
+/*
+** Morton code bits per axis (30-bit codes) and bits per radix sort pass.
+** Three passes leave the sorted keys in buffer LBVH_SORTED.
+*/
+# define MORTON_BITS 10
+# define RADIX_BITS 10
+# define LBVH_SORTED 1
+
+/*
+** Linear BVH build state, one entry per object.
+** codes[b], order[b]: Morton codes and object indices (radix buffers)
+** left[i], right[i]: children of inner node i, which splits sorted
+** objects i and i + 1 (-1: the child is a single object)
+** depth: depth of the node being emitted
+*/
+typedef struct s_lbvh
+{
+	t_object_ref	*refs;
+	t_vec3			*centers;
+	t_aabb			*boxes;
+	unsigned int	*codes[2];
+	int				*order[2];
+	int				*left;
+	int				*right;
+	int				count;
+	int				depth;
+	t_bvh_pool		*pool;
+}	t_lbvh;
+
+/* Leaves of one treelet and the subsets of them (bit k: leaf k) */
+# define TREELET_LEAVES 5
+# define TREELET_SETS 32
+
+/*
+** Treelet restructured by the optimization pass.
+** inner[0] is the treelet root; the rest are reused inner nodes.
+** cost[s], split[s]: lowest inner area sum over subset s, its best split
+*/
+typedef struct s_treelet
+{
+	t_bvh_node	*leaf[TREELET_LEAVES];
+	t_bvh_node	*inner[TREELET_LEAVES - 1];
+	int			leaves;
+	int			inners;
+	t_aabb		box[TREELET_SETS];
+	t_real		cost[TREELET_SETS];
+	int			split[TREELET_SETS];
+}	t_treelet;
+
+/*
+** SBVH: SAH bins per axis. Spatial splits are tried only where the
+** children of the best object split overlap by more than SBVH_ALPHA of
+** the root area; they may duplicate SBVH_BUDGET percent of the objects.
+*/
+# define SBVH_BINS 16
+# define SBVH_ALPHA 0.00001
+# define SBVH_BUDGET 50
+
+/* SBVH reference: an object and its (possibly clipped) bounds */
+typedef struct s_sbvh_ref
+{
+	t_object_ref	ref;
+	t_aabb			box;
+}	t_sbvh_ref;
+
+/*
+** SAH bin: bounds of the references in it, references whose extent
+** starts (enter) and ends (exit) in it.
+*/
+typedef struct s_sbvh_bin
+{
+	t_aabb	box;
+	int		enter;
+	int		exit;
+}	t_sbvh_bin;
+
+/*
+** Best split of one node.
+** lo, width: first bin edge and bin width on axis; plane: bins on the
+** left; spatial: 1 if references crossing the plane are clipped to both
+** sides, 0 if references go by centroid bin
+** side, count: bounds and reference counts of both children
+*/
+typedef struct s_sbvh_split
+{
+	t_real	cost;
+	int		axis;
+	t_real	lo;
+	t_real	width;
+	int		plane;
+	int		spatial;
+	t_aabb	side[2];
+	int		count[2];
+}	t_sbvh_split;
+
+/*
+** SBVH build state.
+** bounds: bounds of the node being split
+** root_area: area of the object center bounds (planes are unbounded)
+** budget: duplicate references still allowed
+*/
+typedef struct s_sbvh
+{
+	t_bvh_pool	*pool;
+	void		*scene;
+	t_aabb		bounds;
+	t_real		root_area;
+	int			budget;
+	int			depth;
+}	t_sbvh;
+
+/* Node arena: reserve for a build, hand out nodes and leaf ranges */
+int			bvh_pool_reserve(t_bvh_pool *pool, int count);
+t_bvh_node	*bvh_pool_node(t_bvh_pool *pool);
+t_object_ref	*bvh_pool_refs(t_bvh_pool *pool, int count);
+void		bvh_pool_free(t_bvh_pool *pool);
 
 /* Internal BVH build partition functions */
-t_aabb		compute_bounds(t_object_ref *objects, int count, void *scene);
+t_aabb		compute_bounds(t_build_prim *prims, int count);
 int			partition_objects(t_partition_params *params);
 
 /* Internal BVH build split functions */
 int			choose_split_axis(t_aabb bounds);
-double		calculate_split_position(t_aabb bounds, int axis);
-t_bvh_node	*create_split_node(t_split_params *sp);
+t_real		calculate_split_position(t_aabb bounds, int axis);
+t_bvh_node	*create_split_node(t_split_params *sp, t_aabb *side);
+t_bvh_node	*bvh_build_bounded(t_split_params *sp);
+
+/*
+** Wide BVH collapse: frame of a node (set before its child boxes), child
+** box of slot i, children of one wide node, traversal stack bound
+*/
+void		bvh_wide_frame(t_bvh_wide *w, t_aabb *boxes, int n);
+void		bvh_wide_slot_box(t_bvh_wide *w, int i, t_aabb box);
+t_aabb		bvh_wide_box(t_bvh_wide *w, int i);
+int			bvh_gather_children(t_bvh_node *node, t_bvh_node **kids,
+				int width);
+int			bvh_wide_stack_fits(t_bvh *bvh);
+
+/* Wide BVH traversal helpers */
+void		bvh_wide_ray_init(t_wide_ray *wr, t_ray *ray);
+int			bvh_wide_order(t_real *tnear, int count, int *order);
+int			bvh_wide_run(t_wide_trav *tr);
+
+/* Packet traversal: leaf objects and inner node children */
+void		bvh_packet_leaf(t_packet_trav *pt, t_wide_entry *e);
+void		bvh_packet_push(t_packet_trav *pt, t_bvh_wide *node, int mask);
 
 /* Internal BVH build core functions */
-t_bvh_node	*create_leaf_node(t_object_ref *objects, int count, void *scene);
+t_bvh_node	*create_leaf_node(t_bvh_pool *pool, t_build_prim *prims,
+				int count, t_aabb bounds);
+
+/* Linear BVH: Morton codes, radix sort, hierarchy and node emission */
+t_bvh_node	*lbvh_build(t_lbvh *l);
+void		lbvh_codes(t_lbvh *l);
+void		lbvh_sort(t_lbvh *l);
+int			lbvh_hierarchy(t_lbvh *l);
+t_bvh_node	*lbvh_emit(t_lbvh *l, int id, int first, int last);
+
+/* SBVH: bins, split search, clipping and reference partition */
+t_bvh_node	*sbvh_node(t_sbvh *s, t_sbvh_ref *refs, int count,
+				t_aabb bounds);
+t_real		sbvh_axis(t_vec3 v, int axis);
+t_real		sbvh_center(t_sbvh_ref *r, int axis);
+int			sbvh_clip(t_sbvh *s, t_sbvh_ref *r, int axis, t_real *slab);
+void		sbvh_bins_clear(t_sbvh_bin *bins);
+int			sbvh_bin(t_sbvh_split *split, t_real v);
+void		sbvh_sweep(t_sbvh_bin *bins, t_sbvh_split *cand,
+				t_sbvh_split *best);
+void		sbvh_object_split(t_sbvh_ref *refs, int count, t_sbvh_split *best);
+void		sbvh_choose_split(t_sbvh *s, t_sbvh_ref *refs, int count,
+				t_sbvh_split *best);
+t_sbvh_ref	*sbvh_partition(t_sbvh *s, t_sbvh_ref *refs, int count,
+				t_sbvh_split *split);
+
+/* Mailbox: skip objects a ray already tested in another leaf */
+void		bvh_mail_reset(t_bvh_mail *mail);
+void		bvh_mail_next(t_bvh *bvh);
+int			bvh_mail_lanes(t_bvh *bvh, t_object_ref ref, int mask);
+
+/* Treelet optimization: best topology of one treelet by subset DP */
+t_real		treelet_optimize(t_treelet *t);
+void		treelet_rebuild(t_treelet *t);
 
 #endif
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frame_cache.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/29 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/29 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FRAME_CACHE_H
+# define FRAME_CACHE_H
+
+# include "minirt.h"
+
+/*
+** Finished frames kept for revisited views. Each slot holds color, pick
+** ids and depth (12 bytes per pixel, ~15.5 MB at 1440x900), so memory is
+** bounded by FRAME_CACHE_SLOTS slots, allocated on first use.
+*/
+# define FRAME_CACHE_SLOTS 4
+/* Key quantization: poses closer than 1 / FRAME_KEY_SCALE match */
+# define FRAME_KEY_SCALE 100000.0
+/* camera position, camera direction, light position, edit generation */
+# define FRAME_KEY_WORDS 10
+
+typedef struct s_render	t_render;
+
+/* Quantized scene state a frame was rendered for */
+typedef struct s_frame_key
+{
+	long	q[FRAME_KEY_WORDS];
+}	t_frame_key;
+
+/*
+** One cached frame.
+** hash: hash of key, compared before the full key
+** last_used: cache clock at the last store or hit (LRU order)
+** color: packed pixels, one row of WINDOW_WIDTH per line (NULL: free)
+*/
+typedef struct s_frame_slot
+{
+	t_frame_key		key;
+	unsigned long	hash;
+	unsigned long	last_used;
+	unsigned int	*color;
+	int				*pick;
+	float			*depth;
+}	t_frame_slot;
+
+/* LRU cache of finished frames with hit / miss counters for the HUD */
+typedef struct s_frame_cache
+{
+	t_frame_slot	slots[FRAME_CACHE_SLOTS];
+	unsigned long	clock;
+	long			hits;
+	long			misses;
+	size_t			bytes;
+}	t_frame_cache;
+
+/* Lifecycle */
+void	frame_cache_init(t_frame_cache *cache);
+void	frame_cache_free(t_frame_cache *cache);
+
+/* Key of the current camera, light and edit generation */
+void	frame_key_build(t_scene *scene, t_frame_key *key);
+/* Slot holding key (hash: FNV-1a of key, set on return), or -1 */
+int		frame_cache_find(t_frame_cache *cache, t_frame_key *key,
+			unsigned long *hash);
+
+/*
+** Keep the frame on screen (a complete full-quality render) under the
+** current key, replacing the least recently used slot when full.
+*/
+void	frame_cache_store(t_frame_cache *cache, t_render *render);
+
+/*
+** Put the cached frame for the current key on screen. Returns 1 on a
+** hit, 0 on a miss (counted; the caller renders as usual).
+*/
+int		frame_cache_restore(t_frame_cache *cache, t_render *render);
+
+#endif
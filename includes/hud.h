@@ -62,7 +62,7 @@ void	set_pixel(t_pixel_params *params, int color);
 /* ========================================================================== */
 
 /*
-** Initialize HUD state and create background overlay image.
+** Initialize HUD state and create background overlay layer.
 ** 
 ** Parameters:
 **   hud: Pointer to HUD state structure to initialize
@@ -70,20 +70,20 @@ void	set_pixel(t_pixel_params *params, int color);
 **   win: Window pointer for rendering context
 **
 ** Returns:
-**   0 on success, -1 on failure (image creation failed)
+**   0 on success, -1 on failure (layer allocation failed)
 **
 ** Side Effects:
-**   - Allocates background image buffer via mlx_new_image
+**   - Allocates the background layer via overlay_init
 **   - Sets default values: visible=1, current_page=0, dirty=1
-**   - Pre-fills background buffer with semi-transparent dark overlay
+**   - Pre-fills the layer with the semi-transparent dark panel
 **
 ** Memory:
-**   Background image must be freed later with hud_cleanup()
+**   The layer must be freed later with hud_cleanup()
 */
 int		hud_init(t_hud_state *hud, void *mlx, void *win);
 
 /*
-** Clean up HUD resources and free background image.
+** Clean up HUD resources and free the background layer.
 **
 ** Parameters:
 **   hud: Pointer to HUD state structure
@@ -93,11 +93,10 @@ int		hud_init(t_hud_state *hud, void *mlx, void *win);
 **   void
 **
 ** Side Effects:
-**   - Destroys background image buffer via mlx_destroy_image
-**   - Sets bg_img and bg_data to NULL
+**   - Frees the layer pixels and sets them to NULL
 **
 ** Safety:
-**   Safe to call even if hud_init failed (checks for NULL pointers)
+**   Safe to call even if hud_init failed (layer pixels are NULL)
 */
 void	hud_cleanup(t_hud_state *hud, void *mlx);
 
@@ -112,7 +111,7 @@ void	hud_cleanup(t_hud_state *hud, void *mlx);
 **
 ** Behavior:
 **   - Returns immediately if hud.visible == 0 (HUD hidden)
-**   - Renders semi-transparent background rectangle
+**   - Refills the HUD layer with the semi-transparent panel
 **   - Renders camera, ambient light, light source information
 **   - Renders object list for current page with pagination
 **   - Highlights selected object if selection is active
@@ -121,7 +120,8 @@ void	hud_cleanup(t_hud_state *hud, void *mlx);
 ** Performance:
 **   - Target: ≤2ms render time
 **   - Optimized via dirty flag (skips if no changes)
-**   - Limited mlx_string_put calls (≤25 per frame)
+**   - Text is drawn into the layer from the built-in font atlas; the
+**     window gets a single mlx_put_image_to_window (render_present)
 **
 ** 42 Norm:
 **   Function delegates to internal helpers to stay under 25 lines
@@ -156,18 +156,18 @@ void	hud_toggle(t_render *render);
 **   void
 **
 ** Behavior:
-**   - Calculates total objects (spheres + planes + cylinders)
-**   - Converts current selection to global index
+**   - Converts current selection to global index (hud.index, O(1))
 **   - Increments index with wraparound
-**   - Updates render->selection with new (type, index)
+**   - Updates render->selection and moves to the page showing it
 **   - Sets render->hud.dirty = 1 to trigger redraw
 **
 ** Edge Cases:
 **   - If total_objects == 0, does nothing
+**   - With no selection yet, selects the first object
 **   - Wraps from last cylinder back to first sphere
 **
 ** Key Binding:
-**   Called from handle_key() on Tab key press
+**   Called from handle_key() on Tab and ']' key press
 */
 void	hud_select_next(t_render *render);
 
@@ -185,7 +185,7 @@ void	hud_select_next(t_render *render);
 **   - Handles wraparound in reverse (first sphere -> last cylinder)
 **
 ** Key Binding:
-**   Called from handle_key() on Shift+Tab key press
+**   Called from handle_key() on Shift+Tab and '[' key press
 */
 void	hud_select_prev(t_render *render);
 
@@ -232,11 +232,17 @@ void	hud_mark_dirty(t_render *render);
 /*                      (Not part of public API contract)                     */
 /* ========================================================================== */
 
+/*
+** Build the virtual object index (first global index of each type).
+** O(1); called once after the scene is parsed.
+*/
+void	hud_index_build(t_object_index *index, t_scene *scene);
+
 /*
 ** Convert selection (type, index) to global linear index.
 ** Used internally for Tab navigation logic.
 */
-int		hud_get_global_index(t_selection sel, t_scene *scene);
+int		hud_get_global_index(t_selection sel, t_object_index *index);
 
 /*
 ** Convert global linear index to selection (type, index).
@@ -244,7 +250,24 @@ int		hud_get_global_index(t_selection sel, t_scene *scene);
 ** Output parameter: sel - pointer to selection structure to fill.
 */
 void	hud_get_selection_from_global(t_selection *sel, int idx,
-			t_scene *scene);
+			t_object_index *index);
+
+/*
+** Find an object by its id ("sp-3", "pl-1", "cy-12").
+** Returns the global index, or -1 if no object has that id.
+*/
+int		hud_index_find_id(t_object_index *index, t_scene *scene,
+			const char *id);
+
+/*
+** Select the object at a global index and move to the page showing it.
+*/
+void	hud_select_global(t_render *render, int idx);
+
+/* Object id helpers: "sp-"/"pl-"/"cy-" prefix, type from id, id string */
+char	*hud_type_prefix(int type);
+int		hud_type_from_id(const char *id);
+char	*hud_object_id(t_scene *scene, int type, int i);
 
 /*
 ** Format floating point number to string with 2 decimal places.
@@ -286,10 +309,10 @@ void	hud_format_fps(char *buf, double fps);
 void	hud_format_time_ms(char *buf, long time_us);
 
 /*
-** Format BVH enabled status to "ON" or "OFF".
-** Buffer must be at least 4 bytes.
+** Format BVH status: "OFF" or "ON" with the node width in use.
+** Buffer must be at least 16 bytes.
 */
-void	hud_format_bvh_status(char *buf, int enabled);
+void	hud_format_bvh_status(char *buf, int enabled, t_bvh *bvh);
 
 /*
 ** Render performance metrics section in HUD.
@@ -299,10 +322,23 @@ void	hud_format_bvh_status(char *buf, int enabled);
 void	hud_render_performance(t_render *render, int *y);
 
 /*
-** Render HUD background overlay (semi-transparent dark rectangle).
-** Called internally by hud_render().
+** Draw one HUD text line (left-aligned in the panel) into the HUD layer.
+** y is the baseline in window coordinates, as with mlx_string_put.
+*/
+void	hud_put_text(t_render *render, int y, int color, char *str);
+
+/*
+** Print one "prefix value suffix" line of the performance section.
+** Advances *params->y by one HUD line.
+*/
+void	hud_print_perf_line(t_render *render, t_perf_text *params);
+
+/*
+** Render shading statistics (average shadow samples per hit,
+** last-occluder cache hit rate) and the previous HUD refresh time.
+** Called by hud_render_performance().
 */
-void	hud_render_background(t_render *render);
+void	hud_render_perf_stats(t_render *render, int *y);
 
 /*
 ** Render HUD text content (camera, lights, objects).
@@ -338,12 +374,12 @@ void	hud_render_objects(t_render *render, int *y);
 ** Calculate total number of pages based on object count.
 ** Called during init and when scene changes.
 */
-int		hud_calculate_total_pages(t_scene *scene);
+int		hud_calculate_total_pages(t_object_index *index);
 
 /*
-** Create and fill background overlay image buffer.
+** Create and fill the cached background overlay layer.
 ** Called during hud_init().
 */
-int		hud_create_background(t_hud_state *hud, void *mlx);
+int		hud_create_background(t_hud_state *hud);
 
 #endif
@@ -16,8 +16,6 @@
 # include "minirt.h"
 
 void	hud_mark_dirty(t_render *render);
-void	hud_render_background_row(t_render *render, int y);
-void	hud_render_background(t_render *render);
 void	format_and_print_vec3(t_render *render, int *y,
 			char *label, t_vec3 vec);
 int		copy_str_to_buf(char *dst, char *src);
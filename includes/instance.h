@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   instance.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/08 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/08 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#ifndef INSTANCE_H
+# define INSTANCE_H
+
+# include "vec3.h"
+# include "ray.h"
+# include "spatial.h"
+
+/* Size of the scene object arrays (spheres, planes, cylinders) */
+# define OBJECT_SLOTS 100
+/* Group definitions per scene and group name length (with '\0') */
+# define GROUP_MAX 16
+# define GROUP_NAME_MAX 16
+
+/*
+** Group of spheres and cylinders defined once (gr <name> ... ge) and
+** placed by instances. The members are ordinary scene objects in group
+** coordinates, stored from the end of the scene arrays so the world
+** object loops (i < sphere_count) never see them:
+** spheres[first_sphere .. first_sphere + sphere_count - 1], same for
+** cylinders.
+** bvh: bottom-level BVH over the members, built once after parsing
+** bounds: group-space bounds of the members
+*/
+typedef struct s_group
+{
+	char	name[GROUP_NAME_MAX];
+	int		first_sphere;
+	int		sphere_count;
+	int		first_cylinder;
+	int		cylinder_count;
+	t_bvh	*bvh;
+	t_aabb	bounds;
+}	t_group;
+
+/*
+** Placement of a group (in <name> <x,y,z> <nx,ny,nz> <scale>).
+** A group point p maps to position + scale * (basis[0] p.x + basis[1] p.y
+** + basis[2] p.z); basis is orthonormal with basis[1] the given axis, so
+** the group's +y axis points along it.
+** bounds, center, radius: world box and bounding sphere of the group
+*/
+typedef struct s_instance
+{
+	int		group;
+	t_vec3	position;
+	t_vec3	basis[3];
+	t_real	scale;
+	t_aabb	bounds;
+	t_vec3	center;
+	t_real	radius;
+}	t_instance;
+
+/* Build every group BVH and the world bounds of every instance */
+int		instances_build(t_scene *scene);
+/* Free the instance array and the group BVHs */
+void	instances_free(t_scene *scene);
+/* World point of a group-space point */
+t_vec3	instance_to_world(t_instance *inst, t_vec3 p);
+
+/*
+** Ray in group space. The direction stays a unit vector, and the origin
+** is moved back by instance_shift so the HIT_EPSILON cut of the group
+** kernels falls at world distance HIT_EPSILON: a group-space distance t
+** is the world distance (t - instance_shift) * scale.
+*/
+t_real	instance_shift(t_instance *inst);
+t_ray	instance_ray(t_instance *inst, t_vec3 origin, t_vec3 dir);
+/* Closest hit of an instance (its group BVH), like intersect_sphere */
+int		intersect_instance(t_scene *scene, int index, t_ray *ray,
+			t_hit *hit);
+/* Brute-force test of every instance (BVH disabled) */
+int		check_instance_intersections(t_scene *scene, t_ray *ray,
+			t_hit *hit);
+
+#endif
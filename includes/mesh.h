@@ -0,0 +1,181 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mesh.h                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/09 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#ifndef MESH_H
+# define MESH_H
+
+# include "vec3.h"
+# include "ray.h"
+# include "spatial.h"
+
+/* Triangles per mesh BVH leaf: one 4-wide Moller-Trumbore batch */
+# define MESH_LEAF_TRIS 4
+/* SAH bins per split and traversal stack depth */
+# define MESH_BINS 12
+# define MESH_STACK 128
+/* Below this depth the builder uses SAH, then halves the count */
+# define MESH_SAH_DEPTH 48
+/* Longest mesh file path in a scene file (with '\0') */
+# define MESH_PATH_MAX 256
+/* Determinants below this are rays parallel to the triangle */
+# define MESH_DET_EPSILON 1e-12f
+
+/*
+** Mesh BVH node (32 bytes), depth-first in one array.
+** count > 0: leaf of triangles [start, start + count) of the index buffer
+** count == 0: inner node, left child is the next node, right is start
+*/
+typedef struct s_mesh_node
+{
+	float	bmin[3];
+	float	bmax[3];
+	int		start;
+	int		count;
+}	t_mesh_node;
+
+/*
+** Triangle mesh loaded from a Wavefront OBJ file (mh element).
+** vertices: 3 floats per vertex, in file coordinates
+** indices: 3 vertex indices per triangle, reordered so every BVH leaf
+** is a contiguous range
+** vertex_capacity, tri_capacity: allocated floats / ints while loading
+** A file point p lies at position + scale * p in the world.
+** bounds, center, radius: world box and bounding sphere
+*/
+typedef struct s_mesh
+{
+	float		*vertices;
+	int			*indices;
+	int			vertex_count;
+	int			vertex_capacity;
+	int			tri_count;
+	int			tri_capacity;
+	t_mesh_node	*nodes;
+	int			node_count;
+	t_vec3		position;
+	t_real		scale;
+	t_color		color;
+	t_aabb		bounds;
+	t_vec3		center;
+	t_real		radius;
+}	t_mesh;
+
+/*
+** Ray in mesh (file) coordinates, single precision like the vertices.
+** tmin, tmax: accepted range, tmax shrinks to the closest hit
+*/
+typedef struct s_mesh_ray
+{
+	float	org[3];
+	float	dir[3];
+	float	inv[3];
+	float	tmin;
+	float	tmax;
+}	t_mesh_ray;
+
+/*
+** Binned SAH builder state.
+** boxes: 6 floats per triangle (min, max), order: triangle permutation
+** cmin, cmax: centroid bounds of the node being split
+*/
+typedef struct s_mesh_build
+{
+	t_mesh	*mesh;
+	float	*boxes;
+	int		*order;
+	int		nodes_used;
+	int		depth;
+	float	cmin[3];
+	float	cmax[3];
+}	t_mesh_build;
+
+/*
+** Centroid bins along one axis: triangle counts and boxes.
+** split: first bin of the right side of the cheapest plane
+*/
+typedef struct s_mesh_bins
+{
+	int		count[MESH_BINS];
+	float	bmin[MESH_BINS][3];
+	float	bmax[MESH_BINS][3];
+	int		axis;
+	float	lo;
+	float	scale;
+	int		split;
+}	t_mesh_bins;
+
+/* Traversal stack: node index and entry distance */
+typedef struct s_mesh_stack
+{
+	int		node[MESH_STACK];
+	float	tnear[MESH_STACK];
+	int		n;
+}	t_mesh_stack;
+
+/* Up to 4 leaf triangles as SoA lanes: first vertex and two edges */
+typedef struct s_mesh_tri4
+{
+	float	v0[3][4];
+	float	e1[3][4];
+	float	e2[3][4];
+}	t_mesh_tri4;
+
+/* Load an OBJ file (v and f lines, polygons as fans) and build its BVH */
+int		mesh_load(const char *path, t_mesh *mesh);
+/* Parse the OBJ text in buf */
+int		mesh_parse_obj(char *buf, t_mesh *mesh);
+/* Parse the vertex list of an f line (after "f ") */
+int		mesh_parse_face(char *p, t_mesh *mesh);
+/* Grow *array to at least need elements of size bytes (doubling) */
+int		mesh_reserve(void **array, int *capacity, int need, int size);
+
+/* Box helpers on float[3] corners */
+void	mesh_box_empty(float *bmin, float *bmax);
+void	mesh_box_grow(float *bmin, float *bmax, float *omin, float *omax);
+float	mesh_box_area(float *bmin, float *bmax);
+/* Bin of a triangle box centroid along bins->axis */
+int		mesh_bin_of(t_mesh_bins *bins, float *box);
+
+/* Build the mesh BVH and reorder the triangles along its leaves */
+int		mesh_build_bvh(t_mesh *mesh);
+/* Recursive build of node over order[start, start + count) */
+void	mesh_build_node(t_mesh_build *b, int node, int start, int count);
+/* Partition order[start, start + count), returns the left count */
+int		mesh_split(t_mesh_build *b, int start, int count);
+
+/* World ray (range up to tmax) to mesh coordinates */
+void	mesh_ray_init(t_mesh *mesh, t_ray *ray, t_real tmax,
+			t_mesh_ray *out);
+/* Closest (any_hit: first) triangle hit, -1 if none; tmax becomes its t */
+int		mesh_traverse(t_mesh *mesh, t_mesh_ray *mray, int any_hit);
+/*
+** Moller-Trumbore on 4 triangle lanes: t[i] is the ray distance, or
+** INFINITY if lane i is missed (range checks are left to the caller)
+*/
+void	mesh_mt4(t_mesh_tri4 *q, t_mesh_ray *r, float *t);
+/* Moller-Trumbore on the triangles of one leaf, -1 if none is closer */
+int		mesh_leaf_intersect(t_mesh *mesh, t_mesh_node *leaf,
+			t_mesh_ray *mray);
+/* Unit face normal of a triangle (mesh coordinates) */
+t_vec3	mesh_triangle_normal(t_mesh *mesh, int tri);
+
+/* World bounds and bounding sphere from the mesh BVH root */
+void	mesh_place(t_mesh *mesh);
+/* Closest hit of a mesh, like intersect_sphere */
+int		intersect_mesh(t_scene *scene, int index, t_ray *ray, t_hit *hit);
+/* Brute-force test of every mesh (BVH disabled) */
+int		check_mesh_intersections(t_scene *scene, t_ray *ray, t_hit *hit);
+/* Free every mesh buffer and the mesh array */
+void	meshes_free(t_scene *scene);
+
+#endif
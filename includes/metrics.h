@@ -30,7 +30,15 @@ typedef struct s_metrics
 	long			bvh_nodes_visited;
 	long			bvh_tests_skipped;
 	long			bvh_box_tests;
+	long			shadow_hits;
+	long			shadow_samples;
+	long			shadow_cache_misses;
+	long			shadow_cache_hits;
+	long			packet_lanes;
+	long			packet_slots;
+	long			hud_time_us;
 	int				quality_mode;
+	int				redraw_percent;
 }	t_metrics;
 
 /* Timer utilities */
@@ -49,10 +57,16 @@ void	metrics_add_intersect_test(t_metrics *metrics);
 void	metrics_add_bvh_node_visit(t_metrics *metrics);
 void	metrics_add_bvh_skip(t_metrics *metrics);
 void	metrics_add_bvh_box_test(t_metrics *metrics);
+void	metrics_add_shadow_samples(t_metrics *metrics, int samples);
+void	metrics_add_shadow_cache(t_metrics *metrics, int hit);
+void	metrics_add_packet(t_metrics *metrics, int mask, int lanes);
 
 /* Metrics calculations */
 double	calculate_fps(t_metrics *m);
 double	calculate_bvh_efficiency(t_metrics *m, int object_count);
 double	calculate_avg_tests_per_ray(t_metrics *m);
+double	calculate_avg_shadow_samples(t_metrics *m);
+double	calculate_shadow_cache_rate(t_metrics *m);
+double	calculate_packet_utilization(t_metrics *m);
 
 #endif
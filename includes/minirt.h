@@ -21,6 +21,8 @@
 # include "ray.h"
 # include "shadow.h"
 # include "render_state.h"
+# include "instance.h"
+# include "mesh.h"
 
 /* Forward declarations */
 typedef struct s_render	t_render;
@@ -28,27 +30,24 @@ typedef struct s_render	t_render;
 /* Helper structure for camera ray calculations */
 typedef struct s_cam_calc
 {
-	double	aspect_ratio;
-	double	fov_scale;
+	t_real	aspect_ratio;
+	t_real	fov_scale;
 	t_vec3	right;
 	t_vec3	up;
 }	t_cam_calc;
 
-/* Epsilon value for floating point comparison to avoid numerical errors */
-# define EPSILON 0.0001
-
 /* Floating point color for intermediate calculations (0.0 - 1.0+) */
 typedef struct s_color_f
 {
-	double	r;
-	double	g;
-	double	b;
+	t_real	r;
+	t_real	g;
+	t_real	b;
 }	t_color_f;
 
 /* Ambient lighting that illuminates all objects uniformly */
 typedef struct s_ambient
 {
-	double	ratio;
+	t_real	ratio;
 	t_color	color;
 }	t_ambient;
 
@@ -59,30 +58,52 @@ typedef struct s_camera
 	t_vec3	direction;
 	t_vec3	initial_position;
 	t_vec3	initial_direction;
-	double	fov;
+	t_real	fov;
 }	t_camera;
 
 /* Point light source emitting from a single point in all directions */
 typedef struct s_light
 {
 	t_vec3	position;
-	double	brightness;
+	t_real	brightness;
 	t_color	color;
 }	t_light;
 
-/* Complete scene: ambient light, camera, light, and geometric objects */
+/*
+** Complete scene: ambient light, camera, light, and geometric objects.
+** sphere_count / cylinder_count count the world objects at the start of
+** the arrays; group members fill them from the end (group_spheres,
+** group_cylinders slots). in_group: the parser is inside gr ... ge.
+** instances: malloc'ed, instance_capacity slots
+** meshes: malloc'ed, mesh_capacity slots
+*/
 typedef struct s_scene
 {
 	t_ambient		ambient;
 	t_camera		camera;
 	t_light			light;
 	t_shadow_config	shadow_config;
+	t_shadow_table	shadow_table;
+	t_shadow_cache	shadow_cache;
+	t_origin_terms	shadow_light;
+	t_origin_terms	primary_origin;
 	t_sphere		spheres[100];
 	int				sphere_count;
 	t_plane			planes[100];
 	int				plane_count;
 	t_cylinder		cylinders[100];
 	int				cylinder_count;
+	t_group			groups[GROUP_MAX];
+	int				group_count;
+	int				group_spheres;
+	int				group_cylinders;
+	int				in_group;
+	t_instance		*instances;
+	int				instance_count;
+	int				instance_capacity;
+	t_mesh			*meshes;
+	int				mesh_count;
+	int				mesh_capacity;
 	int				has_ambient;
 	int				has_camera;
 	int				has_light;
@@ -109,14 +130,55 @@ void	cleanup_all(t_scene *scene, void *render);
 ** Each pixel is ray traced independently.
 ** Uses image buffer for fast rendering.
 ** Supports low quality mode (half resolution) for interactive preview.
+** After object moves only the damaged rectangle is re-traced
+** (render_damage.h); other pixels keep the previous frame.
 */
 void	render_scene_to_buffer(t_scene *scene, t_render *render);
+/* Half-resolution preview (2x2 blocks) of a screen rectangle */
+void	render_low_quality(t_scene *scene, t_render *render,
+			t_tile_rect *rect);
+/* Write one pixel color / primary hit (2x2 block in low quality mode) */
+void	render_put_pixel(t_render *render, int x, int y, t_color color);
+void	render_store_primary(t_render *render, int x, int y,
+			t_primary *primary);
+/* Trace one full-quality pixel and store its color, pick id and depth */
+void	render_pixel(t_scene *scene, t_render *render, int x, int y);
+/* Full-quality pass over a screen rectangle: 2x2 ray packets when the
+** wide BVH is in use, single pixels otherwise */
+void	render_full_quality(t_scene *scene, t_render *render,
+			t_tile_rect *rect);
+/* Cull the wide BVH against the frustum of every tile touching rect */
+void	tile_cull_update(t_scene *scene, t_tile_rect *rect);
 /* Calculate final color at hit point using lighting and shadows */
 t_color	apply_lighting(t_scene *scene, t_hit *hit);
 
+/* Camera basis (right, up) and FOV scale shared by rays and projection */
+void	camera_calc_init(t_camera *camera, t_cam_calc *calc);
+/* Ray direction through NDC point (x, y) for a precomputed basis */
+t_vec3	camera_ray_direction(t_camera *camera, t_cam_calc *calc, t_real x,
+			t_real y);
 /* Create camera ray for given screen coordinates (NDC space) */
-t_ray	create_camera_ray(t_camera *camera, double x, double y);
-/* Trace ray through scene and return color */
-t_color	trace_ray(t_scene *scene, t_ray *ray);
+t_ray	create_camera_ray(t_camera *camera, t_real x, t_real y);
+/* Project a world point to pixel coordinates (0 if behind the camera) */
+int		camera_project(t_camera *camera, t_cam_calc *calc, t_vec3 p,
+			t_real *px);
+/* Per-frame origin terms for camera and light rays; call before tracing */
+void	trace_frame_prepare(t_scene *scene);
+/* Build the origin terms of every object for rays starting at origin */
+void	origin_terms_update(t_origin_terms *terms, t_scene *scene,
+			t_vec3 origin);
+/* Intersect one object, with the primary-ray terms when the ray starts
+** at their origin (the camera) */
+int		intersect_scene_object(t_scene *scene, t_object_ref ref, t_ray *ray,
+			t_hit *hit);
+/* Trace ray through scene and return color (primary: hit id/depth or NULL) */
+t_color	trace_ray(t_scene *scene, t_ray *ray, t_primary *primary);
+/* Count a traced ray and shade its closest hit (black on a miss) */
+t_color	trace_shade(t_scene *scene, int hit_found, t_hit *hit,
+			t_primary *primary);
+/* 1 if primary rays can be traced as packets (wide BVH in use) */
+int		trace_packet_enabled(t_scene *scene);
+/* Closest hits of the camera rays of the 2x2 block at (x, y) */
+void	trace_packet(t_scene *scene, t_ray_packet *packet, int x, int y);
 
 #endif
@@ -27,10 +27,10 @@ typedef struct s_color
 typedef struct s_sphere
 {
 	t_vec3	center;
-	double	diameter;
+	t_real	diameter;
 	t_color	color;
-	double	radius;
-	double	radius_squared;
+	t_real	radius;
+	t_real	radius_squared;
 	char	id[8];
 }	t_sphere;
 
@@ -48,12 +48,12 @@ typedef struct s_cylinder
 {
 	t_vec3	center;
 	t_vec3	axis;
-	double	diameter;
-	double	height;
+	t_real	diameter;
+	t_real	height;
 	t_color	color;
-	double	radius;
-	double	radius_squared;
-	double	half_height;
+	t_real	radius;
+	t_real	radius_squared;
+	t_real	half_height;
 	char	id[8];
 }	t_cylinder;
 
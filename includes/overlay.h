@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   overlay.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/23 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/23 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef OVERLAY_H
+# define OVERLAY_H
+
+/* Built-in 8x8 bitmap font (printable ASCII) */
+# define FONT_WIDTH 8
+# define FONT_HEIGHT 8
+# define FONT_ASCENT 7
+# define FONT_FIRST_CHAR 32
+# define FONT_GLYPH_COUNT 95
+
+/*
+** Cached overlay layer (HUD panel, key guide).
+** Pixels are premultiplied ARGB (alpha in the top byte), one row of
+** `width` pixels after another, placed at (x, y) in window coordinates.
+** Layers are composed over the scene frame into a separate view image,
+** so the scene image itself is never blended into.
+** dirty: content changed since the layer was last composed
+*/
+typedef struct s_overlay
+{
+	unsigned int	*pixels;
+	int				x;
+	int				y;
+	int				width;
+	int				height;
+	int				dirty;
+}	t_overlay;
+
+/*
+** Text cursor: window coordinates of the baseline start (same convention
+** as mlx_string_put) and 0xRRGGBB color.
+*/
+typedef struct s_text_pen
+{
+	int	x;
+	int	y;
+	int	color;
+}	t_text_pen;
+
+/*
+** Allocate layer pixels (width x height, fully transparent).
+** Position (x, y) is left to the caller. Returns 0 or -1 on failure.
+*/
+int		overlay_init(t_overlay *layer, int width, int height);
+
+/* Free layer pixels (safe on a never-initialized, zeroed layer) */
+void	overlay_free(t_overlay *layer);
+
+/* Fill the whole layer with one 0xRRGGBB color at the given opacity */
+void	overlay_fill(t_overlay *layer, int rgb, double alpha);
+
+/*
+** Draw opaque text into the layer from the built-in font atlas,
+** clipped to the layer. Replaces one mlx_string_put round trip.
+*/
+void	overlay_text(t_overlay *layer, t_text_pen pen, const char *str);
+
+/* Glyph rows of a printable character, NULL otherwise */
+const unsigned char	*font_glyph(char c);
+
+/*
+** Fixed-point "over" blend of one row: dst = scene * (1 - a) + layer.
+** R and B are scaled together in one 32-bit multiply (SWAR).
+*/
+void	overlay_blend_row(unsigned int *dst, const unsigned int *scene,
+			const unsigned int *layer, int width);
+
+#endif
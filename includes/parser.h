@@ -71,6 +71,46 @@ int		parse_plane(char *line, t_scene *scene);
  */
 int		parse_cylinder(char *line, t_scene *scene);
 
+/**
+ * @brief Parse group (gr <name> ... ge) and instance (in) elements
+ * @param line Line to parse
+ * @param scene Scene structure
+ * @return 1 on success, 0 on error or unknown identifier
+ */
+int		parse_group_line(char *line, t_scene *scene);
+
+/**
+ * @brief Parse instance element (in <group> <x,y,z> <nx,ny,nz> <scale>)
+ * @param line Line to parse
+ * @param scene Scene structure
+ * @return 1 on success, 0 on error
+ */
+int		parse_instance(char *line, t_scene *scene);
+
+/**
+ * @brief Parse mesh element (mh <file.obj> <x,y,z> <scale> <R,G,B>)
+ * @param line Line to parse
+ * @param scene Scene structure
+ * @return 1 on success, 0 on error
+ */
+int		parse_mesh(char *line, t_scene *scene);
+
+/**
+ * @brief Move the object just parsed into the open group, if any
+ * @param scene Scene structure
+ * @param type OBJ_SPHERE or OBJ_CYLINDER
+ * @return 1
+ */
+int		group_claim(t_scene *scene, int type);
+
+/**
+ * @brief Find a group by name
+ * @param scene Scene structure
+ * @param name Name, ended by a space or '\0'
+ * @return Group index, -1 if not defined
+ */
+int		group_find(t_scene *scene, char *name);
+
 /**
  * @brief Validate scene has required elements
  * @param scene Scene structure to validate
@@ -25,49 +25,104 @@ typedef struct s_ray
 	t_vec3	direction;
 }	t_ray;
 
-/* Ray-object intersection result with hit point and surface info */
+/*
+** Ray-object intersection result with hit point and surface info.
+** obj_type / obj_index identify the object (set by the scene-level
+** traversal, not by the per-shape intersect functions).
+*/
 typedef struct s_hit
 {
 	bool	hit;
-	double	distance;
+	t_real	distance;
 	t_vec3	point;
 	t_vec3	normal;
 	t_color	color;
+	int		obj_type;
+	int		obj_index;
 }	t_hit;
 
 typedef t_hit	t_hit_record;
 
-/* Helper structure for cylinder intersection calculations */
+/*
+** Primary-hit output of trace_ray, kept per pixel by the renderer.
+** pick: hit object id (see PICK_* in window.h)
+** depth: hit distance along the normalized ray, -1 on a miss
+*/
+typedef struct s_primary
+{
+	int		pick;
+	t_real	depth;
+}	t_primary;
+
+/*
+** Ray-cylinder ranges: the ray is inside the infinite cylinder for t in
+** body[0] .. body[1] and between the cap planes for t in slab[0] .. slab[1]
+** (infinite when the ray is parallel to the axis / the caps).
+** da, oa: direction and origin components along the axis
+** cap: 1 if the chosen hit is on a cap, 0 on the side surface
+*/
 typedef struct s_cyl_calc
 {
-	double	a;
-	double	b;
-	double	c;
-	double	discriminant;
-	double	t;
-	double	m;
+	t_real	da;
+	t_real	oa;
+	t_real	body[2];
+	t_real	slab[2];
+	int		cap;
 }	t_cyl_calc;
 
-/* Generic intersection function pointer type */
-typedef int		(*t_intersect_fn)(t_ray *ray, void *object, t_hit *hit);
+/* Origin-term slots per object array (scene arrays hold 100 objects) */
+# define ORIGIN_TERMS 100
+
+/*
+** Origin-only terms of one object, shared by every ray that starts at the
+** same point (primary rays from the camera, shadow rays from the light).
+** oc: O - C (origin minus object center / plane point)
+** oc_axis: oc . axis (cylinders), oc . normal (planes)
+** c: |oc|^2 - r^2 (spheres and cylinders)
+*/
+typedef struct s_origin_term
+{
+	t_vec3	oc;
+	t_real	oc_axis;
+	t_real	c;
+}	t_origin_term;
+
+/*
+** Origin terms of every object, rebuilt once per frame.
+** origin: Point the terms were computed for
+*/
+typedef struct s_origin_terms
+{
+	t_vec3			origin;
+	t_origin_term	spheres[ORIGIN_TERMS];
+	t_origin_term	planes[ORIGIN_TERMS];
+	t_origin_term	cylinders[ORIGIN_TERMS];
+}	t_origin_terms;
 
-/* Helper structure for generic intersection checking */
+/*
+** Helper structure for generic intersection checking.
+** scene: t_scene whose objects of obj_type (count of them) are tested
+*/
 typedef struct s_intersect_params
 {
-	void			*objects;
-	int				count;
-	size_t			obj_size;
-	t_intersect_fn	intersect_fn;
-	t_ray			*ray;
-	t_hit			*hit;
+	void	*scene;
+	int		count;
+	int		obj_type;
+	t_ray	*ray;
+	t_hit	*hit;
 }	t_intersect_params;
 
 /* Function declarations */
 int		intersect_sphere(t_ray *ray, t_sphere *sphere, t_hit *hit);
 int		intersect_plane(t_ray *ray, t_plane *plane, t_hit *hit);
 int		intersect_cylinder(t_ray *ray, t_cylinder *cylinder, t_hit *hit);
-int		intersect_cylinder_body(t_ray *ray, t_cylinder *cyl, t_hit *hit);
-int		intersect_cylinder_cap(t_ray *ray, t_cylinder *cyl, t_hit *hit,
-			double cap_m);
+int		cylinder_slab(t_cylinder *cyl, t_cyl_calc *calc);
+/* Same tests for a ray starting at the origin of precomputed terms */
+int		intersect_sphere_origin(t_ray *ray, t_sphere *sphere,
+			t_origin_term *term, t_hit *hit);
+int		intersect_plane_origin(t_ray *ray, t_plane *plane,
+			t_origin_term *term, t_hit *hit);
+int		intersect_cylinder_origin(t_ray *ray, t_cylinder *cyl,
+			t_origin_term *term, t_hit *hit);
 
 #endif
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   real.h                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/20 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/20 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef REAL_H
+# define REAL_H
+
+/*
+** Scalar type used by the tracer, BVH and shading code.
+** Built with `make FLOAT=1` the renderer runs in single precision
+** (interactive preview build); the default build stays in double.
+** Epsilons are scaled together so float renders stay free of acne.
+** PARALLEL_EPSILON is a direction test, not a distance tolerance, so it
+** is the same in both builds (a wider one drops the plane horizon rows).
+** Float constants carry the f suffix so comparisons against them do not
+** promote the whole expression to double.
+*/
+# ifdef MINIRT_FLOAT
+
+typedef float	t_real;
+
+/* Threshold for parallel / degenerate comparisons */
+#  define EPSILON 0.0005f
+/* Minimum accepted ray parameter t (self-intersection guard) */
+#  define HIT_EPSILON 0.005f
+/* Base offset applied to shadow ray origins */
+#  define SHADOW_BIAS 0.005f
+/* Ray / plane parallel test on the dot product of two unit vectors */
+#  define PARALLEL_EPSILON 0.0001f
+
+# else
+
+typedef double	t_real;
+
+/* Threshold for parallel / degenerate comparisons */
+#  define EPSILON 0.0001
+/* Minimum accepted ray parameter t (self-intersection guard) */
+#  define HIT_EPSILON 0.001
+/* Base offset applied to shadow ray origins */
+#  define SHADOW_BIAS 0.001
+/* Ray / plane parallel test on the dot product of two unit vectors */
+#  define PARALLEL_EPSILON 0.0001
+
+# endif
+
+#endif
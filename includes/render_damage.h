@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_damage.h                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/27 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/27 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef RENDER_DAMAGE_H
+# define RENDER_DAMAGE_H
+
+# include "minirt.h"
+
+/* Fall back to a full frame once damage covers this share of the screen */
+# define DAMAGE_MAX_RATIO 0.4
+/* Pixels added around projected bounds (rounding, 2x2 preview blocks) */
+# define DAMAGE_MARGIN 2
+
+/*
+** Screen-space damage accumulated since the last full-quality frame.
+** full: a change that is not tracked by rectangle (camera, light,
+**   first frame); the next frame re-traces everything
+** x0, y0, x1, y1: union of damaged pixels, [x0, x1) x [y0, y1),
+**   empty while x0 >= x1
+*/
+typedef struct s_damage
+{
+	int	full;
+	int	x0;
+	int	y0;
+	int	x1;
+	int	y1;
+}	t_damage;
+
+/* Projection of a damaged volume to screen space */
+typedef struct s_damage_view
+{
+	t_camera	*camera;
+	t_cam_calc	calc;
+	t_real		min[2];
+	t_real		max[2];
+}	t_damage_view;
+
+/* Damage bookkeeping */
+void	damage_reset(t_damage *damage);
+void	damage_mark_full(t_damage *damage);
+
+/*
+** Add the screen footprint of an object and of the shadow it casts.
+** Call before and after moving it. Planes, objects whose shadow volume
+** is unbounded on screen or reaches behind the camera mark the frame full.
+*/
+void	damage_add_object(t_damage *damage, t_scene *scene, t_object_ref ref);
+
+/*
+** Pixels to trace for the next frame. Returns 1 with the damaged
+** rectangle, or 0 with the whole screen (full frame or damage above
+** DAMAGE_MAX_RATIO).
+*/
+int		damage_frame_rect(t_damage *damage, t_tile_rect *rect);
+
+/*
+** Conservative screen rectangle of box plus its shadow volume.
+** Returns 0 if it cannot be bounded (caller falls back to full frame).
+*/
+int		damage_project_object(t_scene *scene, t_aabb box, t_tile_rect *rect);
+
+/* Corners of the sampled light area (position + soft-shadow disk) */
+void	damage_light_corners(t_scene *scene, t_vec3 *corners);
+
+/*
+** Largest parameter t at which a shadow ray c + t * (c - l) can still
+** reach a receiver, or -1 if the shadow volume is unbounded.
+*/
+t_real	damage_shadow_reach(t_scene *scene, t_aabb box, t_vec3 *c,
+			t_vec3 *l);
+
+#endif
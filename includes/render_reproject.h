@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_reproject.h                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/28 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/28 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef RENDER_REPROJECT_H
+# define RENDER_REPROJECT_H
+
+# include "minirt.h"
+
+typedef struct s_render	t_render;
+
+/*
+** Temporal reprojection of the last frame after a camera step.
+** depth: per-pixel primary hit distance of the frame on screen
+**   (-1: miss or unknown); float to halve the buffer size
+** next_*: warp targets, swapped with depth / pick_ids after a warp
+** camera: camera the frame on screen was rendered or warped for
+** valid: depth describes the frame on screen (last frame was complete
+**   and full quality)
+** pending: a warped frame is on screen and waits for its refinement
+*/
+typedef struct s_reproject
+{
+	float			*depth;
+	float			*next_depth;
+	unsigned int	*next_color;
+	int				*next_pick;
+	t_camera		camera;
+	int				valid;
+	int				pending;
+}	t_reproject;
+
+/* Source and target view of one warp */
+typedef struct s_warp
+{
+	t_camera	*src;
+	t_camera	*dst;
+	t_cam_calc	src_calc;
+	t_cam_calc	dst_calc;
+}	t_warp;
+
+/* Buffers (optional: on failure reprojection is disabled) */
+void	reproject_init(t_reproject *reproj);
+void	reproject_free(t_reproject *reproj);
+
+/*
+** Called after every scene frame: a complete full-quality frame becomes
+** the next warp source, anything else invalidates it.
+*/
+void	reproject_frame_done(t_reproject *reproj, t_camera *camera,
+			int complete, int low_quality);
+
+/*
+** Warp the frame on screen to the current camera and trace only the
+** pixels nothing landed on. No-op when there is no valid source frame.
+*/
+void	reproject_frame(t_render *render);
+
+/* Warp internals */
+void	reproject_warp(t_render *render);
+int		reproject_fill_holes(t_render *render);
+
+#endif
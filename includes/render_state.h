@@ -51,7 +51,12 @@ typedef struct s_tile_rect
 	int	h;
 }	t_tile_rect;
 
-/* Complete render state management */
+/*
+** Complete render state management
+** edit_generation: bumped on every scene edit that the camera and light
+**   do not describe (object moves); part of the frame cache key
+** tiles: per-tile culled BVH roots for primary ray packets
+*/
 typedef struct s_render_state
 {
 	t_quality_mode			quality;
@@ -63,6 +68,8 @@ typedef struct s_render_state
 	int						adaptive_enabled;
 	int						bvh_enabled;
 	int						show_info;
+	unsigned int			edit_generation;
+	t_tile_cull				tiles;
 }	t_render_state;
 
 /* Render state operations */
@@ -14,10 +14,16 @@
 # define SHADOW_H
 
 # include "vec3.h"
+# include "spatial.h"
 
 /* Forward declaration */
 typedef struct s_scene	t_scene;
 
+/* Soft-shadow sample tables: one table per pixel of a 4x4 screen tile */
+# define SHADOW_TILE_SIZE 4
+# define SHADOW_TILE_COUNT 16
+# define SHADOW_MAX_SAMPLES 64
+
 /**
  * @brief Shadow configuration structure
  * 
@@ -26,23 +32,106 @@ typedef struct s_scene	t_scene;
  * softness: Shadow edge softness factor (0.0-1.0)
  * bias_scale: Shadow bias multiplier to prevent shadow acne
  * enable_ao: Enable ambient occlusion (not implemented yet)
+ * adaptive: Probe a few samples first and escalate only in penumbrae
  */
 typedef struct s_shadow_config
 {
 	int		samples;
-	double	softness;
-	double	bias_scale;
+	t_real	softness;
+	t_real	bias_scale;
 	int		enable_ao;
+	int		adaptive;
 }	t_shadow_config;
 
+/**
+ * @brief Precomputed soft-shadow sample offsets
+ * 
+ * Unit-disk offsets (stratified in area and angle) for every tile slot,
+ * rebuilt only when the sample count changes. Each slot uses a different
+ * jitter so neighbouring pixels see different patterns (no banding).
+ * samples: Sample count the table was built for (0 = not built)
+ * tile: Slot of the pixel currently being shaded
+ */
+typedef struct s_shadow_table
+{
+	int		samples;
+	int		tile;
+	t_real	dx[SHADOW_TILE_COUNT][SHADOW_MAX_SAMPLES];
+	t_real	dy[SHADOW_TILE_COUNT][SHADOW_MAX_SAMPLES];
+}	t_shadow_table;
+
+/**
+ * @brief Last-occluder cache for shadow rays
+ * 
+ * Shadow rays of neighbouring pixels are mostly blocked by the same
+ * object, so the blocker found last is tested first. The renderer is
+ * single-threaded, so the scene holds one cache.
+ * type: t_obj_type of the last blocker (OBJ_NONE = empty)
+ * index: Index of the last blocker in its scene array
+ */
+typedef struct s_shadow_cache
+{
+	int	type;
+	int	index;
+}	t_shadow_cache;
+
+/**
+ * @brief One shadow ray, from a light sample toward the shaded point
+ * 
+ * offset: Light sample minus light center (zero for hard shadows)
+ * offset_sq: offset . offset
+ * dir: Unit direction from the sample to the point
+ * min, max: Parameter range that blocks the point
+ */
+typedef struct s_shadow_ray
+{
+	t_vec3	offset;
+	t_real	offset_sq;
+	t_vec3	dir;
+	t_real	min;
+	t_real	max;
+}	t_shadow_ray;
+
+/* Shadow rays tested together: the soft-shadow samples of one point */
+# define SHADOW_PACKET_LANES 16
+
+/**
+ * @brief Shadow ray packet, traced through the scene BVH with a lane mask
+ * 
+ * The samples of one point share their end point and start on the small
+ * light disk, so every lane lies within `reach` of the segment from the
+ * light center to the point. A BVH node whose box, grown by reach, the
+ * segment misses, or an object whose bounding sphere stays farther than
+ * reach from it, is skipped for the whole packet; otherwise each active
+ * lane is tested and blocked lanes leave the active mask.
+ * seg: Point minus light center; seg_sq: seg . seg
+ * reach: Light disk radius plus bias (and a rounding margin)
+ * count: Lanes filled
+ * active: Bit i set while lane i is not blocked
+ * blocked: Number of lanes blocked so far
+ * seg_inv: 1 / seg per axis, for the beam box test (shadow_packet_bvh)
+ */
+typedef struct s_shadow_packet
+{
+	t_shadow_ray	ray[SHADOW_PACKET_LANES];
+	t_vec3			seg;
+	t_real			seg_sq;
+	t_real			reach;
+	t_vec3			seg_inv;
+	int				count;
+	int				active;
+	int				blocked;
+}	t_shadow_packet;
+
 /* Helper structure for shadow sampling parameters */
 typedef struct s_shadow_sample
 {
 	t_scene			*scene;
+	t_shadow_table	*table;
 	t_vec3			point;
 	t_vec3			light_pos;
 	t_shadow_config	*config;
-	double			bias;
+	t_real			bias;
 }	t_shadow_sample;
 
 /**
@@ -74,7 +163,7 @@ void			set_shadow_samples(t_shadow_config *config, int samples);
  * @param config Shadow configuration
  * @param softness Softness factor (0.0-1.0)
  */
-void			set_shadow_softness(t_shadow_config *config, double softness);
+void			set_shadow_softness(t_shadow_config *config, t_real softness);
 
 /**
  * @brief Calculate adaptive shadow bias
@@ -87,8 +176,8 @@ void			set_shadow_softness(t_shadow_config *config, double softness);
  * @param base_bias Base bias value
  * @return Adjusted bias value
  */
-double			calculate_shadow_bias(t_vec3 normal, t_vec3 light_dir,
-					double base_bias);
+t_real			calculate_shadow_bias(t_vec3 normal, t_vec3 light_dir,
+					t_real base_bias);
 
 /**
  * @brief Generate shadow sample offset
@@ -101,9 +190,167 @@ double			calculate_shadow_bias(t_vec3 normal, t_vec3 light_dir,
  * @param total_samples Total number of samples
  * @return Offset vector
  */
-t_vec3			generate_shadow_sample_offset(double radius,
+t_vec3			generate_shadow_sample_offset(t_real radius,
 					int sample_index, int total_samples);
 
+/**
+ * @brief Rebuild the sample tables if the sample count changed
+ * 
+ * Called once per frame; all trigonometry happens here.
+ * 
+ * @param table Shadow sample tables
+ * @param samples Current number of shadow samples
+ */
+void			shadow_table_update(t_shadow_table *table, int samples);
+
+/**
+ * @brief Per-frame shadow setup
+ * 
+ * Rebuilds the sample tables if needed and the light-relative terms of
+ * every object (scene->shadow_light). Called by trace_frame_prepare().
+ * 
+ * @param scene Scene data
+ */
+void			shadow_frame_prepare(t_scene *scene);
+
+/**
+ * @brief Occlusion tests against the light-relative terms
+ * 
+ * @param scene Scene data
+ * @param i Object index in its scene array
+ * @param ray Shadow ray
+ * @return 1 if the object blocks the ray inside [min, max]
+ */
+int				shadow_hits_sphere(t_scene *scene, int i, t_shadow_ray *ray);
+int				shadow_hits_plane(t_scene *scene, int i, t_shadow_ray *ray);
+int				shadow_hits_cylinder(t_scene *scene, int i,
+					t_shadow_ray *ray);
+
+/**
+ * @brief Occlusion test of one instance (its group BVH in group space)
+ * 
+ * @param scene Scene data
+ * @param i Instance index
+ * @param ray Shadow ray
+ * @return 1 if a group member blocks the ray inside [min, max]
+ */
+int				shadow_hits_instance(t_scene *scene, int i,
+					t_shadow_ray *ray);
+
+/**
+ * @brief Occlusion test of one mesh (any hit in its mesh BVH)
+ * 
+ * @param scene Scene data
+ * @param i Mesh index
+ * @param ray Shadow ray
+ * @return 1 if a triangle blocks the ray inside [min, max]
+ */
+int				shadow_hits_mesh(t_scene *scene, int i, t_shadow_ray *ray);
+
+/**
+ * @brief Occlusion test of any object (t_obj_type, index)
+ * 
+ * @return 1 if the object exists and blocks the ray, 0 otherwise
+ */
+int				shadow_hits_object(t_scene *scene, int type, int index,
+					t_shadow_ray *ray);
+
+/**
+ * @brief Build the shadow ray from a light sample toward params->point
+ * 
+ * @param params Shadow sampling parameters (scene, point, bias)
+ * @param light_pos Light sample position
+ * @param ray Output shadow ray
+ * @return 0 if the point lies on the light sample (never occluded)
+ */
+int				shadow_ray_init(t_shadow_sample *params, t_vec3 light_pos,
+					t_shadow_ray *ray);
+
+/**
+ * @brief Add the ray toward sample `index` as the next packet lane
+ * 
+ * @param params Shadow sampling parameters
+ * @param packet Shadow packet (count < SHADOW_PACKET_LANES)
+ * @param index Sample index in [0, config->samples)
+ */
+void			shadow_packet_add(t_shadow_sample *params,
+					t_shadow_packet *packet, int index);
+
+/**
+ * @brief Test one object against the lanes that are still active
+ * 
+ * Skipped when the beam misses the object; a blocking object becomes the
+ * cached occluder.
+ * 
+ * @param scene Scene data
+ * @param p Shadow packet
+ * @param ref Object (type, index)
+ */
+void			shadow_packet_object(t_scene *scene, t_shadow_packet *p,
+					t_object_ref ref);
+
+/**
+ * @brief Walk the scene BVH with the packet and its active lane mask
+ * 
+ * Node boxes are tested once per packet against the beam: the segment
+ * from the light center to the point, with the box grown by reach.
+ * 
+ * @param scene Scene data
+ * @param p Shadow packet
+ * @return 0 if there is no enabled scene BVH (nothing was tested)
+ */
+int				shadow_packet_bvh(t_scene *scene, t_shadow_packet *p);
+
+/**
+ * @brief Test every lane of the packet and empty it
+ * 
+ * The cached last occluder is tested first, then the scene BVH is walked
+ * (every object when there is none); blocked lanes count as occluder
+ * cache hits or misses like single rays.
+ * 
+ * @param scene Scene data
+ * @param packet Shadow packet
+ * @return Number of blocked lanes
+ */
+int				shadow_packet_flush(t_scene *scene, t_shadow_packet *packet);
+
+/**
+ * @brief Conservative whole-packet miss test
+ * 
+ * @param scene Scene data
+ * @param packet Shadow packet (seg and reach set)
+ * @param type Object type (t_obj_type)
+ * @param index Object index
+ * @return 1 if no lane can hit the object (planes are never culled)
+ */
+int				shadow_packet_culled(t_scene *scene, t_shadow_packet *packet,
+					int type, int index);
+
+
+/**
+ * @brief Tile slot of a pixel (4x4 ordered-dither layout)
+ * 
+ * @param x Pixel column
+ * @param y Pixel row
+ * @return Slot index in [0, SHADOW_TILE_COUNT)
+ */
+int				shadow_tile_index(int x, int y);
+
+/**
+ * @brief Look up the light offset of one shadow sample
+ * 
+ * Falls back to generate_shadow_sample_offset() when the table was not
+ * built for this sample count (e.g. more than SHADOW_MAX_SAMPLES).
+ * 
+ * @param table Shadow sample tables (tile selects the pixel slot)
+ * @param radius Sampling radius
+ * @param index Sample index
+ * @param samples Total number of samples
+ * @return Offset vector
+ */
+t_vec3			shadow_table_offset(t_shadow_table *table, t_real radius,
+					int index, int samples);
+
 /**
  * @brief Calculate shadow factor using multiple shadow rays
  * 
@@ -116,9 +363,22 @@ t_vec3			generate_shadow_sample_offset(double radius,
  * @param config Shadow configuration
  * @return Shadow factor (0.0-1.0)
  */
-double			calculate_shadow_factor(t_scene *scene, t_vec3 point,
+t_real			calculate_shadow_factor(t_scene *scene, t_vec3 point,
 					t_vec3 light_pos, t_shadow_config *config);
 
+/**
+ * @brief Estimate shadow factor with adaptive sampling
+ * 
+ * Casts probe rays first (one per ring and sector of the light disk plus
+ * the outer ring) and stops when they agree; otherwise casts the
+ * remaining samples.
+ * 
+ * @param params Shadow sampling parameters
+ * @param fired Output: number of shadow rays actually cast
+ * @return Shadow factor (0.0-1.0)
+ */
+t_real			shadow_sample_adaptive(t_shadow_sample *params, int *fired);
+
 /**
  * @brief Calculate distance-based shadow attenuation
  * 
@@ -129,21 +389,7 @@ double			calculate_shadow_factor(t_scene *scene, t_vec3 point,
  * @param softness Softness factor
  * @return Attenuation factor (0.0-1.0)
  */
-double			calculate_shadow_attenuation(double distance,
-					double max_distance, double softness);
-
-/**
- * @brief Test if point is in shadow (single ray)
- * 
- * Casts a single shadow ray to determine if point is occluded.
- * 
- * @param scene Scene data
- * @param point Point to test
- * @param light_pos Light source position
- * @param bias Shadow bias offset
- * @return 1 if in shadow, 0 if lit
- */
-int				is_in_shadow(t_scene *scene, t_vec3 point,
-					t_vec3 light_pos, double bias);
+t_real			calculate_shadow_attenuation(t_real distance,
+					t_real max_distance, t_real softness);
 
 #endif
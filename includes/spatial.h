@@ -45,14 +45,191 @@ typedef struct s_bvh_node
 	int					depth;
 }	t_bvh_node;
 
-/* BVH tree root structure */
+/*
+** Children per wide BVH node (BVH4 / BVH8) and traversal stack size
+** (bvh_collapse keeps the binary tree if a deep tree could overflow it)
+*/
+# define BVH_WIDE_MAX 8
+# define BVH_WIDE_STACK 256
+/* Node width used until changed at runtime (N key): 2, 4 or 8 */
+# define BVH_DEFAULT_WIDTH 4
+
+/*
+** Wide BVH node collapsed from the binary tree. Child boxes are stored
+** in SoA form (bmin[axis][child]) so one slab test runs over all
+** children at once; unused slots hold an empty box.
+** child[i]: wide node index (count[i] == 0) or first entry in wide_refs
+** count[i]: object count of a leaf child, 0 for an inner child
+** n: children in use
+**
+** make QBVH=1 stores the child boxes quantized instead: 8-bit steps of
+** scale[axis] from origin[axis], the frame of the node, rounded outward.
+** Children larger than BVH_QUANT_HUGE on some axis (planes) set their
+** bit in huge and are always entered.
+*/
+# define BVH_QUANT_HUGE 100000
+
+# ifdef MINIRT_QBVH
+
+typedef struct s_bvh_wide
+{
+	float			origin[3];
+	float			scale[3];
+	unsigned char	qmin[3][BVH_WIDE_MAX];
+	unsigned char	qmax[3][BVH_WIDE_MAX];
+	int				huge;
+	int				child[BVH_WIDE_MAX];
+	int				count[BVH_WIDE_MAX];
+	int				n;
+}	t_bvh_wide;
+
+# else
+
+typedef struct s_bvh_wide
+{
+	t_real	bmin[3][BVH_WIDE_MAX];
+	t_real	bmax[3][BVH_WIDE_MAX];
+	int		child[BVH_WIDE_MAX];
+	int		count[BVH_WIDE_MAX];
+	int		n;
+}	t_bvh_wide;
+
+# endif
+
+/* Ray prepared for the wide slab test (origin, 1 / direction, range) */
+typedef struct s_wide_ray
+{
+	t_real	org[3];
+	t_real	inv[3];
+	t_real	tmax;
+}	t_wide_ray;
+
+/*
+** Pending child on the wide traversal stack (t: box entry distance).
+** mask: packet lanes whose ray enters the box (packet traversal only)
+*/
+typedef struct s_wide_entry
+{
+	int		child;
+	int		count;
+	t_real	t;
+	int		mask;
+}	t_wide_entry;
+
+/* Rays per primary packet: one 2x2 pixel block */
+# define PACKET_LANES 4
+
+/*
+** Primary ray packet traced through the wide BVH together.
+** hit[i]: closest hit of lane i (distance is the upper bound on entry)
+** found: bit i set if lane i hit an object
+** root: tile root to start from (t_tile_cull), NULL for the BVH root
+*/
+typedef struct s_ray_packet
+{
+	t_ray			ray[PACKET_LANES];
+	t_hit_record	hit[PACKET_LANES];
+	int				found;
+	t_bvh_wide		*root;
+}	t_ray_packet;
+
+/* Screen tile edge (pixels) for frustum culling of primary rays */
+# define TILE_CULL_SIZE 16
+
+/*
+** Pyramid holding every primary ray of one screen tile: the camera
+** position and the inward normals of the four side planes through it.
+*/
+typedef struct s_frustum
+{
+	t_vec3	origin;
+	t_vec3	normal[4];
+}	t_frustum;
+
+/*
+** Per-tile roots for primary rays. Each root is a wide node whose
+** children are the BVH nodes left after culling against the tile
+** frustum, expanded as deep as BVH_WIDE_MAX slots allow.
+** roots[row * cols + col]: NULL until first used (or if out of memory)
+*/
+typedef struct s_tile_cull
+{
+	t_bvh_wide	*roots;
+	int			cols;
+	int			rows;
+}	t_tile_cull;
+
+/*
+** Arena holding every node of one build and the leaf object lists.
+** Leaves point at consecutive ranges of refs. A rebuild resets the
+** counters and reuses the arrays while they are large enough.
+** nodes: 2 * objects - 1 slots (a binary tree with non-empty leaves)
+*/
+typedef struct s_bvh_pool
+{
+	t_bvh_node		*nodes;
+	t_object_ref	*refs;
+	int				node_cap;
+	int				ref_cap;
+	int				nodes_used;
+	int				refs_used;
+}	t_bvh_pool;
+
+/*
+** BVH builders: top-down median split, linear build from sorted Morton
+** codes (LBVH) for fast rebuilds of large scenes, or SAH build with
+** spatial splits (SBVH) for long, overlapping cylinders.
+*/
+# define BVH_BUILD_MEDIAN 0
+# define BVH_BUILD_LBVH 1
+# define BVH_BUILD_SBVH 2
+# define BVH_DEFAULT_BUILDER BVH_BUILD_LBVH
+
+/* Object types (t_obj_type values) and objects per type (t_scene) */
+# define BVH_MAIL_TYPES 4
+# define BVH_MAIL_OBJECTS 100
+
+/*
+** Mailbox for trees with duplicated references (SBVH): the ray or
+** packet that last tested each object and the lanes it tested, so a
+** reference met again in another leaf is skipped.
+** stamp[type][index]: value of current when the object was last tested
+*/
+typedef struct s_bvh_mail
+{
+	unsigned int	stamp[BVH_MAIL_TYPES][BVH_MAIL_OBJECTS];
+	int				lanes[BVH_MAIL_TYPES][BVH_MAIL_OBJECTS];
+	unsigned int	current;
+}	t_bvh_mail;
+
+/*
+** BVH tree root structure.
+** width: 2 traverses the binary tree, 4 or 8 the collapsed wide nodes
+** wide, wide_refs: flat wide node and leaf object arrays (NULL if unused)
+** wide_bounds: bounds of the leaves smaller than BVH_QUANT_HUGE (frame of
+** the tile roots)
+** builder: BVH_BUILD_MEDIAN, BVH_BUILD_LBVH or BVH_BUILD_SBVH
+** treelets: 1 to restructure LBVH treelets for a lower SAH cost
+** pool: storage of the binary tree under root
+** duplicates: 1 if an object is referenced by more than one leaf
+*/
 typedef struct s_bvh
 {
-	t_bvh_node	*root;
-	int			enabled;
-	int			total_nodes;
-	int			max_depth;
-	int			visualize;
+	t_bvh_node		*root;
+	int				enabled;
+	int				total_nodes;
+	int				max_depth;
+	int				visualize;
+	int				width;
+	t_bvh_wide		*wide;
+	t_object_ref	*wide_refs;
+	int				wide_count;
+	t_aabb			wide_bounds;
+	int				builder;
+	int				treelets;
+	t_bvh_pool		pool;
+	int				duplicates;
+	t_bvh_mail		mail;
 }	t_bvh;
 
 /* Helper structure for BVH hit checking */
@@ -68,60 +245,90 @@ typedef struct s_hit_check
 /* Axis intersection check parameters */
 typedef struct s_axis_check
 {
-	double	box_min;
-	double	box_max;
-	double	ray_origin;
-	double	ray_direction;
-	double	*tmin;
-	double	*tmax;
+	t_real	box_min;
+	t_real	box_max;
+	t_real	ray_origin;
+	t_real	ray_direction;
+	t_real	*tmin;
+	t_real	*tmax;
 }	t_axis_check;
 
-/* BVH partition parameters */
+/* Object with its bounds and center, looked up once per build */
+typedef struct s_build_prim
+{
+	t_object_ref	ref;
+	t_aabb			box;
+	t_vec3			center;
+}	t_build_prim;
+
+/*
+** BVH partition parameters.
+** side: bounds of the left and right part, filled by the partition so
+** the children do not scan their objects again
+*/
 typedef struct s_partition_params
 {
-	t_object_ref	*objects;
+	t_build_prim	*prims;
 	int				count;
 	int				axis;
-	double			split;
-	void			*scene;
+	t_real			split;
+	t_aabb			side[2];
 }	t_partition_params;
 
 /* BVH split node parameters */
 typedef struct s_split_params
 {
+	t_bvh_pool		*pool;
 	t_aabb			bounds;
-	t_object_ref	*objects;
+	t_build_prim	*prims;
 	int				mid;
 	int				count;
-	void			*scene;
 	int				depth;
 }	t_split_params;
 
 /* Helper functions */
-double		min_double(double a, double b);
-double		max_double(double a, double b);
+t_real		min_real(t_real a, t_real b);
+t_real		max_real(t_real a, t_real b);
 
 /* AABB operations */
 t_aabb		aabb_create(t_vec3 min, t_vec3 max);
 t_aabb		aabb_merge(t_aabb a, t_aabb b);
-t_aabb		aabb_for_sphere(t_vec3 center, double radius);
-t_aabb		aabb_for_cylinder(t_vec3 center, t_vec3 axis, double radius,
-				double height);
+t_aabb		aabb_for_sphere(t_vec3 center, t_real radius);
+t_aabb		aabb_for_cylinder(t_vec3 center, t_vec3 axis, t_real radius,
+				t_real height);
 t_aabb		aabb_for_plane(t_vec3 point, t_vec3 normal);
-int			aabb_intersect(t_aabb box, t_ray ray, double *t_min, double *t_max);
-double		aabb_surface_area(t_aabb box);
+int			aabb_intersect(t_aabb box, t_ray ray, t_real *t_min, t_real *t_max);
+t_real		aabb_surface_area(t_aabb box);
 
 /* BVH construction */
 t_bvh		*bvh_create(void);
 void		bvh_destroy(t_bvh *bvh);
 void		bvh_build(t_bvh *bvh, t_object_ref *objects, int count,
 				void *scene);
-t_bvh_node	*bvh_build_recursive(t_object_ref *objects, int count,
-				void *scene, int depth);
+t_bvh_node	*bvh_build_recursive(t_bvh *bvh, t_object_ref *objects,
+				int count, void *scene);
+t_bvh_node	*bvh_build_lbvh(t_bvh *bvh, t_object_ref *objects, int count,
+				void *scene);
+t_bvh_node	*bvh_build_sbvh(t_bvh *bvh, t_object_ref *objects, int count,
+				void *scene);
+void		bvh_treelet_optimize(t_bvh_node *node);
+
+/* Wide BVH: collapse the binary tree to 4 / 8 children per node */
+int			bvh_collapse(t_bvh *bvh);
+void		bvh_wide_free(t_bvh *bvh);
+void		bvh_set_width(t_bvh *bvh, int width);
 
 /* BVH traversal */
 int			bvh_intersect(t_bvh *bvh, t_ray ray, t_hit_record *hit,
 				void *scene);
+int			bvh_wide_intersect(t_bvh *bvh, t_ray ray, t_hit_record *hit,
+				void *scene);
+void		bvh_wide_slab(t_bvh_wide *node, t_wide_ray *ray, t_real *tnear);
+int			bvh_packet_intersect(t_bvh *bvh, t_ray_packet *packet,
+				void *scene);
+
+/* Tile-frustum culling: wide root of the nodes inside one tile frustum */
+void		bvh_tile_root(t_bvh *bvh, t_frustum *f, t_bvh_wide *root);
 int			bvh_node_intersect(t_bvh_node *node, t_ray ray, t_hit_record *hit,
 				void *scene);
 
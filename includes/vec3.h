@@ -6,34 +6,171 @@
 /*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/18 15:18:44 by yoshin            #+#    #+#             */
-/*   Updated: 2025/12/18 15:18:45 by yoshin           ###   ########.fr       */
+/*   Updated: 2026/01/20 14:00:00 by yoshin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef VEC3_H
 # define VEC3_H
 
+# include <math.h>
+# include "real.h"
+
+/*
+** Vector math is header-inline so the intersection, camera and lighting
+** inner loops do not pay a call (and a 24-byte struct copy) per operation.
+** `make SIMD=1` defines MINIRT_SSE2: double-precision add/subtract/scale/dot
+** then run on SSE2 registers and normalize uses the hardware rsqrt estimate
+** refined by Newton-Raphson steps.
+*/
+# if defined(MINIRT_SSE2) && defined(__SSE2__)
+#  include <emmintrin.h>
+#  include <float.h>
+#  define VEC3_USE_SSE2 1
+# else
+#  define VEC3_USE_SSE2 0
+# endif
+
+# ifdef MINIRT_FLOAT
+#  define VEC3_SQRT sqrtf
+# else
+#  define VEC3_SQRT sqrt
+# endif
+
 /* 3D vector or point in space with x, y, z coordinates */
 typedef struct s_vec3
 {
-	double	x;
-	double	y;
-	double	z;
+	t_real	x;
+	t_real	y;
+	t_real	z;
 }	t_vec3;
 
+# if VEC3_USE_SSE2 && !defined(MINIRT_FLOAT)
+
+/* Add two vectors component-wise (x, y in one SSE2 lane pair) */
+static inline t_vec3	vec3_add(t_vec3 a, t_vec3 b)
+{
+	t_vec3	r;
+
+	_mm_storeu_pd(&r.x, _mm_add_pd(_mm_loadu_pd(&a.x), _mm_loadu_pd(&b.x)));
+	r.z = a.z + b.z;
+	return (r);
+}
+
+/* Subtract vector b from vector a component-wise */
+static inline t_vec3	vec3_subtract(t_vec3 a, t_vec3 b)
+{
+	t_vec3	r;
+
+	_mm_storeu_pd(&r.x, _mm_sub_pd(_mm_loadu_pd(&a.x), _mm_loadu_pd(&b.x)));
+	r.z = a.z - b.z;
+	return (r);
+}
+
+/* Multiply vector by scalar value */
+static inline t_vec3	vec3_multiply(t_vec3 v, t_real scalar)
+{
+	t_vec3	r;
+
+	_mm_storeu_pd(&r.x, _mm_mul_pd(_mm_loadu_pd(&v.x),
+			_mm_set1_pd(scalar)));
+	r.z = v.z * scalar;
+	return (r);
+}
+
+/* Calculate dot product of two vectors */
+static inline t_real	vec3_dot(t_vec3 a, t_vec3 b)
+{
+	__m128d	xy;
+
+	xy = _mm_mul_pd(_mm_loadu_pd(&a.x), _mm_loadu_pd(&b.x));
+	xy = _mm_add_sd(xy, _mm_unpackhi_pd(xy, xy));
+	return (_mm_cvtsd_f64(xy) + a.z * b.z);
+}
+
+# else
+
 /* Add two vectors component-wise */
-t_vec3	vec3_add(t_vec3 a, t_vec3 b);
+static inline t_vec3	vec3_add(t_vec3 a, t_vec3 b)
+{
+	return ((t_vec3){a.x + b.x, a.y + b.y, a.z + b.z});
+}
+
 /* Subtract vector b from vector a component-wise */
-t_vec3	vec3_subtract(t_vec3 a, t_vec3 b);
+static inline t_vec3	vec3_subtract(t_vec3 a, t_vec3 b)
+{
+	return ((t_vec3){a.x - b.x, a.y - b.y, a.z - b.z});
+}
+
 /* Multiply vector by scalar value */
-t_vec3	vec3_multiply(t_vec3 v, double scalar);
+static inline t_vec3	vec3_multiply(t_vec3 v, t_real scalar)
+{
+	return ((t_vec3){v.x * scalar, v.y * scalar, v.z * scalar});
+}
+
 /* Calculate dot product of two vectors */
-double	vec3_dot(t_vec3 a, t_vec3 b);
+static inline t_real	vec3_dot(t_vec3 a, t_vec3 b)
+{
+	return (a.x * b.x + a.y * b.y + a.z * b.z);
+}
+
+# endif
+
+# if VEC3_USE_SSE2
+
+/*
+** Reciprocal square root: rsqrtss estimate (~12 bits) refined by one
+** Newton-Raphson step in float, two in double. x must be positive.
+** rsqrtss only sees a float, so x outside the normal float range (a
+** double below FLT_MIN or above FLT_MAX, or a float denormal) takes the
+** exact path instead of a flushed or infinite estimate.
+*/
+static inline t_real	vec3_rsqrt(t_real x)
+{
+	t_real	y;
+
+	if (x < FLT_MIN || x > FLT_MAX)
+		return ((t_real)1.0 / VEC3_SQRT(x));
+	y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss((float)x)));
+	y = y * ((t_real)1.5 - (t_real)0.5 * x * y * y);
+	if (sizeof(t_real) > sizeof(float))
+		y = y * ((t_real)1.5 - (t_real)0.5 * x * y * y);
+	return (y);
+}
+
+# else
+
+/* Reciprocal square root (exact). x must be positive. */
+static inline t_real	vec3_rsqrt(t_real x)
+{
+	return ((t_real)1.0 / VEC3_SQRT(x));
+}
+
+# endif
+
 /* Calculate cross product of two vectors */
-t_vec3	vec3_cross(t_vec3 a, t_vec3 b);
+static inline t_vec3	vec3_cross(t_vec3 a, t_vec3 b)
+{
+	return ((t_vec3){a.y * b.z - a.z * b.y,
+		a.z * b.x - a.x * b.z,
+		a.x * b.y - a.y * b.x});
+}
+
 /* Calculate magnitude (length) of vector */
-double	vec3_magnitude(t_vec3 v);
-/* Return normalized vector (length = 1) */
-t_vec3	vec3_normalize(t_vec3 v);
+static inline t_real	vec3_magnitude(t_vec3 v)
+{
+	return (VEC3_SQRT(vec3_dot(v, v)));
+}
+
+/* Return normalized vector (length = 1); zero vector stays zero */
+static inline t_vec3	vec3_normalize(t_vec3 v)
+{
+	t_real	len_sq;
+
+	len_sq = vec3_dot(v, v);
+	if (len_sq <= 0)
+		return ((t_vec3){0, 0, 0});
+	return (vec3_multiply(v, vec3_rsqrt(len_sq)));
+}
 
 #endif
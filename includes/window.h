@@ -17,6 +17,10 @@
 # include "mlx.h"
 # include "pixel_timing.h"
 # include "render_debounce.h"
+# include "overlay.h"
+# include "render_damage.h"
+# include "render_reproject.h"
+# include "frame_cache.h"
 
 /* Window resolution constants - MacBook M1 13-inch native resolution */
 # define WINDOW_WIDTH 1440
@@ -24,15 +28,28 @@
 # define ASPECT_RATIO_NUM 1440.0
 # define ASPECT_RATIO_DEN 900.0
 
-/* Object type enumeration for selection */
+/*
+** Object type enumeration (instances and meshes are traced but not
+** selectable)
+*/
 typedef enum e_obj_type
 {
 	OBJ_NONE = 0,
 	OBJ_SPHERE,
 	OBJ_PLANE,
-	OBJ_CYLINDER
+	OBJ_CYLINDER,
+	OBJ_INSTANCE,
+	OBJ_MESH
 }	t_obj_type;
 
+/*
+** Pick buffer ids: one int per pixel written from the primary hits,
+** (type << PICK_TYPE_SHIFT) | index, or PICK_NONE for background.
+*/
+# define PICK_NONE -1
+# define PICK_TYPE_SHIFT 24
+# define PICK_INDEX_MASK 0xFFFFFF
+
 /* Selected object information */
 typedef struct s_selection
 {
@@ -40,32 +57,47 @@ typedef struct s_selection
 	int			index;
 }	t_selection;
 
+/*
+** Virtual HUD object list (spheres, then planes, then cylinders).
+** first[type] is the global index of the first object of that type and
+** first[OBJ_CYLINDER + 1] the total, so paging, cycling and id lookups
+** are O(1) whatever the scene size. Built once after parsing.
+*/
+typedef struct s_object_index
+{
+	int	first[OBJ_CYLINDER + 2];
+	int	total;
+}	t_object_index;
+
+/* Jump-to-id entry (J key): object type prefix plus typed number */
+typedef struct s_jump_entry
+{
+	int		active;
+	int		type;
+	int		len;
+	char	digits[8];
+}	t_jump_entry;
+
 /* HUD state structure */
 typedef struct s_hud_state
 {
-	int		visible;
-	int		current_page;
-	int		objects_per_page;
-	int		total_pages;
-	int		dirty;
-	void	*bg_img;
-	char	*bg_data;
-	int		bpp;
-	int		size_line;
-	int		endian;
+	int				visible;
+	int				current_page;
+	int				objects_per_page;
+	int				total_pages;
+	int				dirty;
+	t_overlay		layer;
+	t_object_index	index;
+	t_jump_entry	jump;
 }	t_hud_state;
 
 /* Key guide state structure */
 typedef struct s_keyguide_state
 {
-	void	*bg_img;
-	char	*bg_data;
-	int		bpp;
-	int		size_line;
-	int		endian;
-	int		visible;
-	int		x;
-	int		y;
+	t_overlay	layer;
+	int			visible;
+	int			x;
+	int			y;
 }	t_keyguide_state;
 
 /* Render context containing MLX pointers and scene data */
@@ -75,6 +107,10 @@ typedef struct s_render
 	void				*win;
 	void				*img;
 	char				*img_data;
+	void				*view_img;
+	char				*view_data;
+	int					view_valid;
+	int					*pick_ids;
 	int					bpp;
 	int					size_line;
 	int					endian;
@@ -88,6 +124,9 @@ typedef struct s_render
 	t_keyguide_state	keyguide;
 	t_pixel_timing		pixel_timing;
 	t_debounce_state	debounce;
+	t_damage			damage;
+	t_reproject			reproj;
+	t_frame_cache		frame_cache;
 }	t_render;
 
 /* Initialize MLX window and set up event handlers */
@@ -98,6 +137,8 @@ int			close_window(void *param);
 int			handle_key(int keycode, void *param);
 /* Handle key release events */
 int			handle_key_release(int keycode, void *param);
+/* Handle mouse clicks (left click picks the object under the cursor) */
+int			handle_mouse(int button, int x, int y, void *param);
 /* Main rendering loop */
 int			render_loop(void *param);
 
@@ -49,6 +49,11 @@
 #  define KEY_DELETE 117
 #  define KEY_END 119
 #  define KEY_PGDN 121
+#  define KEY_J 38
+#  define KEY_N 45
+#  define KEY_RETURN 36
+#  define KEY_BACKSPACE 51
+#  define KEY_DIGIT_CODES {29, 18, 19, 20, 21, 23, 22, 26, 28, 25}
 # elif defined(__linux__)
 /* Linux/X11 KeySym values */
 #  define KEY_ESC 65307
@@ -82,8 +87,16 @@
 #  define KEY_DELETE 65535
 #  define KEY_END 65367
 #  define KEY_PGDN 65366
+#  define KEY_J 106
+#  define KEY_N 110
+#  define KEY_RETURN 65293
+#  define KEY_BACKSPACE 65288
+#  define KEY_DIGIT_CODES {48, 49, 50, 51, 52, 53, 54, 55, 56, 57}
 # endif
 
+/* Mouse buttons (same on macOS and X11) */
+# define MOUSE_LEFT 1
+
 /* Camera control functions */
 void	handle_camera_move(t_render *render, int keycode);
 void	handle_camera_pitch(t_render *render, int keycode);
@@ -99,14 +112,12 @@ void	handle_hud_keys(t_render *render, int keycode);
 void	handle_camera_keys(t_render *render, int keycode);
 void	handle_transform_keys(t_render *render, int keycode);
 
-/* Selection helper functions */
-void	cycle_type_forward(t_render *render);
-void	cycle_backward_sphere(t_render *render);
-void	cycle_backward_plane(t_render *render);
-void	cycle_backward_cylinder(t_render *render);
-int		next_type_from_sphere(t_scene *scene);
-int		next_type_from_plane(t_scene *scene);
-int		next_type_from_cylinder(t_scene *scene);
+/* Frame presentation (scene + cached overlay layers) */
+void	render_present(t_render *render);
+
+/* Jump-to-id entry (HUD object index) */
+void	handle_jump_start(t_render *render);
+int		handle_jump_key(t_render *render, int keycode);
 
 /* Forward declaration for re-rendering */
 void	render_scene_to_buffer(t_scene *scene, t_render *render);
@@ -1,17 +1,46 @@
 #!/bin/bash
 # Compare rendered images between baseline and current
-# Usage: ./scripts/compare_renders.sh [baseline_dir] [current_dir]
+# Usage: ./scripts/compare_renders.sh [baseline_dir] [current_dir] [tolerance]
+#
+# tolerance: maximum per-channel difference (0-255) still accepted for PPM
+#            images, e.g. 8 when comparing a FLOAT=1 build against the
+#            double-precision baseline. Defaults to 0 (binary comparison).
+# OUTLIER_PERMILLE: channels allowed above tolerance, per mille (default 1).
 
 set -e
 
 BASELINE_DIR="${1:-baseline_renders}"
 CURRENT_DIR="${2:-current_renders}"
+TOLERANCE="${3:-0}"
+OUTLIER_PERMILLE="${OUTLIER_PERMILLE:-1}"
+
+# Returns 0 if two PPM files differ by at most TOLERANCE per channel
+# (ignoring up to OUTLIER_PERMILLE of the channels).
+within_tolerance() {
+    local size
+    size=$(wc -c < "$1" | tr -d ' ')
+    cmp -l "$1" "$2" 2>/dev/null | awk -v tol="$TOLERANCE" \
+        -v size="$size" -v permille="$OUTLIER_PERMILLE" '
+        function oct(s,    n, i) {
+            n = 0
+            for (i = 1; i <= length(s); i++)
+                n = n * 8 + substr(s, i, 1)
+            return n
+        }
+        {
+            d = oct($2) - oct($3)
+            if (d < 0) d = -d
+            if (d > tol) bad++
+        }
+        END { exit (bad * 1000 > size * permille) }'
+}
 
 echo "========================================="
 echo "Render Comparison Script"
 echo "========================================="
 echo "Baseline: $BASELINE_DIR"
 echo "Current:  $CURRENT_DIR"
+echo "Tolerance: $TOLERANCE"
 echo ""
 
 if [ ! -d "$BASELINE_DIR" ]; then
@@ -50,17 +79,21 @@ for baseline_img in "$BASELINE_DIR"/*.{ppm,png}; do
     
     if [ ! -f "$current_img" ]; then
         echo "✗ MISSING: $filename"
-        ((missing_count++))
+        missing_count=$((missing_count + 1))
         continue
     fi
     
     # Binary comparison
     if cmp -s "$baseline_img" "$current_img"; then
         echo "✓ IDENTICAL: $filename"
-        ((pass_count++))
+        pass_count=$((pass_count + 1))
+    elif [ "$TOLERANCE" -gt 0 ] && [[ "$filename" == *.ppm ]] \
+        && within_tolerance "$baseline_img" "$current_img"; then
+        echo "✓ WITHIN TOLERANCE: $filename"
+        pass_count=$((pass_count + 1))
     else
         echo "✗ DIFFERS: $filename"
-        ((fail_count++))
+        fail_count=$((fail_count + 1))
     fi
 done
 
@@ -68,7 +101,7 @@ echo ""
 echo "========================================="
 echo "Results:"
 echo "========================================="
-echo "Identical:  $pass_count"
+echo "Matching:   $pass_count"
 echo "Different:  $fail_count"
 echo "Missing:    $missing_count"
 
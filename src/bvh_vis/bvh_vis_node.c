@@ -13,6 +13,7 @@
 #include "bvh_vis.h"
 #include "minirt.h"
 #include "window.h"
+#include "format_object_id.h"
 #include <stdio.h>
 #include <string.h>
 
@@ -33,8 +34,9 @@ t_node_info	format_node_info(t_bvh_node *node, t_vis_config *config)
 		strcpy(info.type, "Internal");
 	snprintf(info.bounds, sizeof(info.bounds),
 		"min(%.2f, %.2f, %.2f) max(%.2f, %.2f, %.2f)",
-		node->bounds.min.x, node->bounds.min.y, node->bounds.min.z,
-		node->bounds.max.x, node->bounds.max.y, node->bounds.max.z);
+		(double)node->bounds.min.x, (double)node->bounds.min.y,
+		(double)node->bounds.min.z, (double)node->bounds.max.x,
+		(double)node->bounds.max.y, (double)node->bounds.max.z);
 	info.objects[0] = '\0';
 	return (info);
 }
@@ -43,35 +45,27 @@ void	format_bounding_box(t_aabb bounds, char *buffer, int compact)
 {
 	if (compact)
 		snprintf(buffer, 128, "[%.1f,%.1f,%.1f]-[%.1f,%.1f,%.1f]",
-			bounds.min.x, bounds.min.y, bounds.min.z,
-			bounds.max.x, bounds.max.y, bounds.max.z);
+			(double)bounds.min.x, (double)bounds.min.y, (double)bounds.min.z,
+			(double)bounds.max.x, (double)bounds.max.y, (double)bounds.max.z);
 	else
 		snprintf(buffer, 128, "min(%.2f, %.2f, %.2f) max(%.2f, %.2f, %.2f)",
-			bounds.min.x, bounds.min.y, bounds.min.z,
-			bounds.max.x, bounds.max.y, bounds.max.z);
+			(double)bounds.min.x, (double)bounds.min.y, (double)bounds.min.z,
+			(double)bounds.max.x, (double)bounds.max.y, (double)bounds.max.z);
 }
 
 void	format_object_list(t_object_ref *objects, int count, char *buffer,
 			void *scene_ptr)
 {
-	int			i;
-	char		*id;
-	t_scene		*scene;
+	int		i;
+	char	id[8];
 
-	scene = (t_scene *)scene_ptr;
+	(void)scene_ptr;
 	strcpy(buffer, "Objects: [");
 	i = 0;
 	while (i < count)
 	{
-		id = NULL;
-		if (objects[i].type == OBJ_SPHERE)
-			id = scene->spheres[objects[i].index].id;
-		else if (objects[i].type == OBJ_PLANE)
-			id = scene->planes[objects[i].index].id;
-		else if (objects[i].type == OBJ_CYLINDER)
-			id = scene->cylinders[objects[i].index].id;
-		if (id)
-			strcat(buffer, id);
+		format_object_id(id, (t_obj_type)objects[i].type, objects[i].index);
+		strcat(buffer, id);
 		if (i < count - 1)
 			strcat(buffer, ", ");
 		i++;
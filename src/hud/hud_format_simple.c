@@ -42,11 +42,16 @@ void	hud_format_time_ms(char *buf, long time_us)
  *
  * @param buf 파라미터
  * @param enabled 파라미터
+ * @param bvh 노드 폭을 읽을 BVH (NULL 가능)
  */
-void	hud_format_bvh_status(char *buf, int enabled)
+void	hud_format_bvh_status(char *buf, int enabled, t_bvh *bvh)
 {
-	if (enabled)
-		ft_strcpy(buf, "ON");
-	else
+	if (!enabled || !bvh)
 		ft_strcpy(buf, "OFF");
+	else if (bvh->width == 8 && bvh->wide)
+		ft_strcpy(buf, "ON (BVH8)");
+	else if (bvh->width == 4 && bvh->wide)
+		ft_strcpy(buf, "ON (BVH4)");
+	else
+		ft_strcpy(buf, "ON (binary)");
 }
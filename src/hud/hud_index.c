@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hud_index.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/25 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/25 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "window.h"
+#include "hud.h"
+
+/**
+ * @brief hud index build 함수 - 가상 객체 목록 구성
+ *
+ * 타입별 시작 전역 인덱스만 저장하므로 객체 수와 무관하게 O(1)이다.
+ *
+ * @param index 파라미터
+ * @param scene 파라미터
+ */
+void	hud_index_build(t_object_index *index, t_scene *scene)
+{
+	index->first[OBJ_NONE] = 0;
+	index->first[OBJ_SPHERE] = 0;
+	index->first[OBJ_PLANE] = scene->sphere_count;
+	index->first[OBJ_CYLINDER] = scene->sphere_count + scene->plane_count;
+	index->total = index->first[OBJ_CYLINDER] + scene->cylinder_count;
+	index->first[OBJ_CYLINDER + 1] = index->total;
+}
+
+/**
+ * @brief hud get global index 함수 - 조회 수행
+ *
+ * @param sel 파라미터
+ * @param index 파라미터
+ *
+ * @return int 반환값 (선택 없음이면 0)
+ */
+int	hud_get_global_index(t_selection sel, t_object_index *index)
+{
+	if (sel.type == OBJ_NONE)
+		return (0);
+	return (index->first[sel.type] + sel.index);
+}
+
+/**
+ * @brief hud get selection from global 함수 - 조회 수행
+ *
+ * @param sel 파라미터
+ * @param idx 전역 인덱스 (0 <= idx < index->total)
+ * @param index 파라미터
+ */
+void	hud_get_selection_from_global(t_selection *sel, int idx,
+	t_object_index *index)
+{
+	sel->type = OBJ_CYLINDER;
+	while (sel->type > OBJ_SPHERE && idx < index->first[sel->type])
+		sel->type--;
+	sel->index = idx - index->first[sel->type];
+}
+
+/**
+ * @brief ids equal 함수 - 두 ID 문자열 비교
+ *
+ * @param a 파라미터
+ * @param b 파라미터
+ *
+ * @return int 같으면 1
+ */
+static int	ids_equal(const char *a, const char *b)
+{
+	while (*a && *a == *b)
+	{
+		a++;
+		b++;
+	}
+	return (*a == *b);
+}
+
+/**
+ * @brief hud index find id 함수 - ID로 객체 찾기
+ *
+ * 파서가 "sp-N", "pl-N", "cy-N" 순서대로 ID를 붙이므로 접두사와
+ * 번호로 위치를 계산한 뒤 실제 ID와 비교만 한다 (O(1)).
+ *
+ * @param index 파라미터
+ * @param scene 파라미터
+ * @param id 찾을 ID 문자열
+ *
+ * @return int 전역 인덱스, 없으면 -1
+ */
+int	hud_index_find_id(t_object_index *index, t_scene *scene, const char *id)
+{
+	int	type;
+	int	n;
+
+	type = hud_type_from_id(id);
+	if (type == OBJ_NONE)
+		return (-1);
+	n = ft_atoi(id + 3) - 1;
+	if (n < 0 || n >= index->first[type + 1] - index->first[type])
+		return (-1);
+	if (!ids_equal(hud_object_id(scene, type, n), id))
+		return (-1);
+	return (index->first[type] + n);
+}
@@ -16,56 +16,35 @@
 /**
  * @brief hud create background 함수 - 생성 수행
  *
+ * 반투명 배경 패널을 오버레이 레이어에 한 번만 채워 둔다.
+ *
  * @param hud 파라미터
- * @param mlx 파라미터
  *
  * @return int 반환값
  */
-int	hud_create_background(t_hud_state *hud, void *mlx)
+int	hud_create_background(t_hud_state *hud)
 {
-	int	x;
-	int	y;
-	int	pixel;
-
-	hud->bg_img = mlx_new_image(mlx, HUD_WIDTH, HUD_HEIGHT);
-	if (!hud->bg_img)
+	if (overlay_init(&hud->layer, HUD_WIDTH, HUD_HEIGHT) == -1)
 		return (-1);
-	hud->bg_data = mlx_get_data_addr(hud->bg_img, &hud->bpp,
-			&hud->size_line, &hud->endian);
-	y = 0;
-	while (y < HUD_HEIGHT)
-	{
-		x = 0;
-		while (x < HUD_WIDTH)
-		{
-			pixel = (int)(HUD_COLOR_BG * HUD_BG_ALPHA);
-			((int *)hud->bg_data)[y * (hud->size_line / 4) + x] = pixel;
-			x++;
-		}
-		y++;
-	}
+	hud->layer.x = HUD_MARGIN_X;
+	hud->layer.y = HUD_MARGIN_Y;
+	overlay_fill(&hud->layer, HUD_COLOR_BG, HUD_BG_ALPHA);
 	return (0);
 }
 
 /**
  * @brief hud calculate total pages 함수 - 계산 수행
  *
- * @param scene 파라미터
+ * @param index 파라미터
  *
  * @return int 반환값
  */
-int	hud_calculate_total_pages(t_scene *scene)
+int	hud_calculate_total_pages(t_object_index *index)
 {
-	int	total_objects;
-	int	total_pages;
-
-	total_objects = scene->sphere_count + scene->plane_count
-		+ scene->cylinder_count;
-	if (total_objects == 0)
+	if (index->total == 0)
 		return (1);
-	total_pages = (total_objects + HUD_OBJECTS_PER_PAGE - 1)
-		/ HUD_OBJECTS_PER_PAGE;
-	return (total_pages);
+	return ((index->total + HUD_OBJECTS_PER_PAGE - 1)
+		/ HUD_OBJECTS_PER_PAGE);
 }
 
 /**
@@ -80,13 +59,13 @@ int	hud_calculate_total_pages(t_scene *scene)
 int	hud_init(t_hud_state *hud, void *mlx, void *win)
 {
 	(void)win;
+	(void)mlx;
 	hud->visible = 1;
 	hud->current_page = 0;
 	hud->objects_per_page = HUD_OBJECTS_PER_PAGE;
 	hud->dirty = 1;
-	hud->bg_img = NULL;
-	hud->bg_data = NULL;
-	if (hud_create_background(hud, mlx) == -1)
+	hud->jump.active = 0;
+	if (hud_create_background(hud) == -1)
 		return (-1);
 	return (0);
 }
@@ -99,10 +78,6 @@ int	hud_init(t_hud_state *hud, void *mlx, void *win)
  */
 void	hud_cleanup(t_hud_state *hud, void *mlx)
 {
-	if (hud->bg_img)
-	{
-		mlx_destroy_image(mlx, hud->bg_img);
-		hud->bg_img = NULL;
-		hud->bg_data = NULL;
-	}
+	(void)mlx;
+	overlay_free(&hud->layer);
 }
@@ -14,42 +14,19 @@
 #include "hud.h"
 
 /**
- * @brief hud get global index 함수 - 조회 수행
+ * @brief hud select global 함수 - 전역 인덱스로 선택
  *
- * @param sel 파라미터
- * @param scene 파라미터
+ * 선택된 객체가 보이도록 현재 페이지도 함께 옮긴다.
  *
- * @return int 반환값
+ * @param render 파라미터
+ * @param idx 전역 인덱스
  */
-int	hud_get_global_index(t_selection sel, t_scene *scene)
-{
-	if (sel.type == OBJ_SPHERE)
-		return (sel.index);
-	else if (sel.type == OBJ_PLANE)
-		return (scene->sphere_count + sel.index);
-	else if (sel.type == OBJ_CYLINDER)
-		return (scene->sphere_count + scene->plane_count + sel.index);
-	return (0);
-}
-
-void	hud_get_selection_from_global(t_selection *sel, int idx,
-	t_scene *scene)
+void	hud_select_global(t_render *render, int idx)
 {
-	if (idx < scene->sphere_count)
-	{
-		sel->type = OBJ_SPHERE;
-		sel->index = idx;
-	}
-	else if (idx < scene->sphere_count + scene->plane_count)
-	{
-		sel->type = OBJ_PLANE;
-		sel->index = idx - scene->sphere_count;
-	}
-	else
-	{
-		sel->type = OBJ_CYLINDER;
-		sel->index = idx - scene->sphere_count - scene->plane_count;
-	}
+	hud_get_selection_from_global(&render->selection, idx,
+		&render->hud.index);
+	render->hud.current_page = idx / HUD_OBJECTS_PER_PAGE;
+	render->hud.dirty = 1;
 }
 
 /**
@@ -59,18 +36,16 @@ void	hud_get_selection_from_global(t_selection *sel, int idx,
  */
 void	hud_select_next(t_render *render)
 {
-	int	total_objects;
-	int	idx;
+	t_object_index	*index;
+	int				idx;
 
-	total_objects = render->scene->sphere_count
-		+ render->scene->plane_count + render->scene->cylinder_count;
-	if (total_objects == 0)
+	index = &render->hud.index;
+	if (index->total == 0)
 		return ;
-	idx = hud_get_global_index(render->selection, render->scene);
-	idx = (idx + 1) % total_objects;
-	hud_get_selection_from_global(&render->selection, idx,
-		render->scene);
-	render->hud.dirty = 1;
+	idx = -1;
+	if (render->selection.type != OBJ_NONE)
+		idx = hud_get_global_index(render->selection, index);
+	hud_select_global(render, (idx + 1) % index->total);
 }
 
 /**
@@ -80,18 +55,16 @@ void	hud_select_next(t_render *render)
  */
 void	hud_select_prev(t_render *render)
 {
-	int	total_objects;
-	int	idx;
+	t_object_index	*index;
+	int				idx;
 
-	total_objects = render->scene->sphere_count
-		+ render->scene->plane_count + render->scene->cylinder_count;
-	if (total_objects == 0)
+	index = &render->hud.index;
+	if (index->total == 0)
 		return ;
-	idx = hud_get_global_index(render->selection, render->scene);
-	idx = (idx - 1 + total_objects) % total_objects;
-	hud_get_selection_from_global(&render->selection, idx,
-		render->scene);
-	render->hud.dirty = 1;
+	idx = 1;
+	if (render->selection.type != OBJ_NONE)
+		idx = hud_get_global_index(render->selection, index);
+	hud_select_global(render, (idx - 1 + index->total) % index->total);
 }
 
 /**
@@ -111,5 +84,4 @@ void	hud_change_page(t_render *render, int direction)
 		render->hud.current_page = (render->hud.current_page - 1
 				+ render->hud.total_pages) % render->hud.total_pages;
 	render->hud.dirty = 1;
-	render->dirty = 1;
 }
@@ -39,8 +39,7 @@ void	render_sphere_obj(t_render *render, int idx, int *y, int color)
 	buf[i++] = 's';
 	buf[i] = '\0';
 	hud_format_vec3(buf + i, render->scene->spheres[idx].center);
-	mlx_string_put(render->mlx, render->win, HUD_MARGIN_X + 10,
-		*y, color, buf);
+	hud_put_text(render, *y, color, buf);
 	*y += HUD_LINE_HEIGHT;
 }
 
@@ -69,8 +68,7 @@ void	render_plane_obj(t_render *render, int idx, int *y, int color)
 	buf[i++] = 's';
 	buf[i] = '\0';
 	hud_format_vec3(buf + i, render->scene->planes[idx].point);
-	mlx_string_put(render->mlx, render->win, HUD_MARGIN_X + 10,
-		*y, color, buf);
+	hud_put_text(render, *y, color, buf);
 	*y += HUD_LINE_HEIGHT;
 }
 
@@ -99,7 +97,6 @@ void	render_cylinder_obj(t_render *render, int idx, int *y, int color)
 	buf[i++] = 's';
 	buf[i] = '\0';
 	hud_format_vec3(buf + i, render->scene->cylinders[idx].center);
-	mlx_string_put(render->mlx, render->win, HUD_MARGIN_X + 10,
-		*y, color, buf);
+	hud_put_text(render, *y, color, buf);
 	*y += HUD_LINE_HEIGHT;
 }
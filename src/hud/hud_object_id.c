@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hud_object_id.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/25 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/25 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "window.h"
+#include "hud.h"
+
+/**
+ * @brief hud type prefix 함수 - 타입별 ID 접두사
+ *
+ * @param type 파라미터
+ *
+ * @return char* "sp-", "pl-", "cy-" (그 외 "")
+ */
+char	*hud_type_prefix(int type)
+{
+	if (type == OBJ_SPHERE)
+		return ("sp-");
+	if (type == OBJ_PLANE)
+		return ("pl-");
+	if (type == OBJ_CYLINDER)
+		return ("cy-");
+	return ("");
+}
+
+/**
+ * @brief hud type from id 함수 - ID 접두사로 타입 판별
+ *
+ * @param id 파라미터
+ *
+ * @return int 객체 타입, 알 수 없으면 OBJ_NONE
+ */
+int	hud_type_from_id(const char *id)
+{
+	const char	*prefix;
+	int			type;
+
+	type = OBJ_SPHERE;
+	while (type <= OBJ_CYLINDER)
+	{
+		prefix = hud_type_prefix(type);
+		if (id[0] == prefix[0] && id[0] && id[1] == prefix[1] && id[1]
+			&& id[2] == prefix[2])
+			return (type);
+		type++;
+	}
+	return (OBJ_NONE);
+}
+
+/**
+ * @brief hud object id 함수 - 객체 ID 문자열 조회
+ *
+ * @param scene 파라미터
+ * @param type 파라미터
+ * @param i 타입 내 인덱스
+ *
+ * @return char* ID 문자열
+ */
+char	*hud_object_id(t_scene *scene, int type, int i)
+{
+	if (type == OBJ_SPHERE)
+		return (scene->spheres[i].id);
+	if (type == OBJ_PLANE)
+		return (scene->planes[i].id);
+	return (scene->cylinders[i].id);
+}
@@ -41,8 +41,7 @@ static void	render_object_header(t_render *render, int *y)
 		len++;
 	len += copy_str_to_buf(buf + len, ") ---");
 	buf[len] = '\0';
-	mlx_string_put(render->mlx, render->win, HUD_MARGIN_X + 10,
-		*y, HUD_COLOR_TEXT, buf);
+	hud_put_text(render, *y, HUD_COLOR_TEXT, buf);
 	*y += HUD_LINE_HEIGHT;
 }
 
@@ -58,7 +57,7 @@ static void	render_object_by_index(t_render *render, int g_idx, int *y)
 	t_selection	sel;
 	int			color;
 
-	hud_get_selection_from_global(&sel, g_idx, render->scene);
+	hud_get_selection_from_global(&sel, g_idx, &render->hud.index);
 	color = HUD_COLOR_TEXT;
 	if (sel.type == render->selection.type
 		&& sel.index == render->selection.index)
@@ -71,35 +70,51 @@ static void	render_object_by_index(t_render *render, int g_idx, int *y)
 		render_cylinder_obj(render, sel.index, y, color);
 }
 
+/**
+ * @brief render jump entry 함수 - 입력 중인 ID 표시
+ *
+ * @param render 파라미터
+ * @param y 파라미터
+ */
+static void	render_jump_entry(t_render *render, int *y)
+{
+	char	buf[32];
+	int		len;
+
+	len = copy_str_to_buf(buf, "Jump to: ");
+	len += copy_str_to_buf(buf + len, hud_type_prefix(render->hud.jump.type));
+	len += copy_str_to_buf(buf + len, render->hud.jump.digits);
+	buf[len++] = '_';
+	buf[len] = '\0';
+	hud_put_text(render, *y, HUD_COLOR_HIGHLIGHT, buf);
+	*y += HUD_LINE_HEIGHT;
+}
+
 /**
  * @brief hud render objects 함수 - 렌더링 수행
  *
+ * 현재 페이지의 객체만 포맷하므로 비용은 장면 크기와 무관하다.
+ *
  * @param render 파라미터
  * @param y 파라미터
  */
 void	hud_render_objects(t_render *render, int *y)
 {
-	int	total_objects;
 	int	start_idx;
 	int	end_idx;
-	int	i;
 
-	total_objects = render->scene->sphere_count + render->scene->plane_count
-		+ render->scene->cylinder_count;
-	render->hud.total_pages = hud_calculate_total_pages(render->scene);
 	if (render->hud.current_page >= render->hud.total_pages)
 		render->hud.current_page = 0;
 	render_object_header(render, y);
-	if (total_objects == 0)
-		return ;
+	if (render->hud.jump.active)
+		render_jump_entry(render, y);
 	start_idx = render->hud.current_page * HUD_OBJECTS_PER_PAGE;
 	end_idx = start_idx + HUD_OBJECTS_PER_PAGE;
-	if (end_idx > total_objects)
-		end_idx = total_objects;
-	i = start_idx;
-	while (i < end_idx)
+	if (end_idx > render->hud.index.total)
+		end_idx = render->hud.index.total;
+	while (start_idx < end_idx)
 	{
-		render_object_by_index(render, i, y);
-		i++;
+		render_object_by_index(render, start_idx, y);
+		start_idx++;
 	}
 }
@@ -6,7 +6,7 @@
 /*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/31 00:00:00 by yoshin            #+#    #+#             */
-/*   Updated: 2025/12/31 00:00:00 by yoshin           ###   ########.fr       */
+/*   Updated: 2026/01/21 10:00:00 by yoshin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,8 +21,7 @@
  */
 static void	render_perf_header(t_render *render, int *y)
 {
-	mlx_string_put(render->mlx, render->win,
-		HUD_MARGIN_X + 10, *y, HUD_COLOR_HIGHLIGHT, "=== Performance ===");
+	hud_put_text(render, *y, HUD_COLOR_HIGHLIGHT, "=== Performance ===");
 	*y += HUD_LINE_HEIGHT;
 }
 
@@ -49,12 +48,12 @@ static int	copy_str(char *dst, char *src, int max_len)
 }
 
 /**
- * @brief concat and print 함수
+ * @brief hud print perf line 함수 - prefix + value + suffix 한 줄 출력
  *
  * @param render 파라미터
  * @param params 파라미터
  */
-static void	concat_and_print(t_render *render, t_perf_text *params)
+void	hud_print_perf_line(t_render *render, t_perf_text *params)
 {
 	char	line[128];
 	int		len;
@@ -64,8 +63,7 @@ static void	concat_and_print(t_render *render, t_perf_text *params)
 	if (params->suffix)
 		len += copy_str(line + len, params->suffix, 128 - len);
 	line[len] = '\0';
-	mlx_string_put(render->mlx, render->win,
-		HUD_MARGIN_X + 10, *params->y, HUD_COLOR_TEXT, line);
+	hud_put_text(render, *params->y, HUD_COLOR_TEXT, line);
 	*params->y += HUD_LINE_HEIGHT;
 }
 
@@ -87,17 +85,18 @@ static void	render_perf_basic(t_render *render, int *y)
 	params.prefix = "FPS: ";
 	params.value = buf;
 	params.suffix = NULL;
-	concat_and_print(render, &params);
+	hud_print_perf_line(render, &params);
 	hud_format_time_ms(buf, m->render_time_us);
 	params.prefix = "Frame: ";
 	params.value = buf;
 	params.suffix = "ms";
-	concat_and_print(render, &params);
-	hud_format_bvh_status(buf, render->scene->render_state.bvh_enabled);
+	hud_print_perf_line(render, &params);
+	hud_format_bvh_status(buf, render->scene->render_state.bvh_enabled,
+		render->scene->render_state.bvh);
 	params.prefix = "BVH: ";
 	params.value = buf;
 	params.suffix = NULL;
-	concat_and_print(render, &params);
+	hud_print_perf_line(render, &params);
 }
 
 /**
@@ -110,4 +109,5 @@ void	hud_render_performance(t_render *render, int *y)
 {
 	render_perf_header(render, y);
 	render_perf_basic(render, y);
+	hud_render_perf_stats(render, y);
 }
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hud_performance_stats.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/21 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/21 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "hud.h"
+#include "metrics.h"
+
+/**
+ * @brief render redraw stat 함수 - 렌더링 수행
+ *
+ * 직전 프레임에서 다시 추적한 화면 비율 (부분 재렌더링).
+ *
+ * @param render 파라미터
+ * @param params 출력 위치가 설정된 파라미터
+ */
+static void	render_redraw_stat(t_render *render, t_perf_text *params)
+{
+	char	buf[16];
+
+	ft_itoa_buf(buf, render->scene->render_state.metrics.redraw_percent);
+	params->prefix = "Redrawn: ";
+	params->value = buf;
+	params->suffix = "%";
+	hud_print_perf_line(render, params);
+}
+
+/**
+ * @brief render packet stat 함수 - 렌더링 수행
+ *
+ * 광선 묶음 검사에서 활성 레인의 비율 (주 광선 2x2 묶음과 그림자
+ * 샘플 묶음). 묶음을 쓰지 않은 프레임은 0%.
+ *
+ * @param render 파라미터
+ * @param params 출력 위치가 설정된 파라미터
+ */
+static void	render_packet_stat(t_render *render, t_perf_text *params)
+{
+	char	buf[64];
+
+	hud_format_float(buf, calculate_packet_utilization(
+			&render->scene->render_state.metrics));
+	params->prefix = "Packet lanes: ";
+	params->value = buf;
+	params->suffix = "%";
+	hud_print_perf_line(render, params);
+}
+
+/**
+ * @brief render frame cache stats 함수 - 렌더링 수행
+ *
+ * 프레임 캐시 적중/실패 횟수와 사용 중인 메모리 (MB).
+ *
+ * @param render 파라미터
+ * @param params 출력 위치가 설정된 파라미터
+ */
+static void	render_frame_cache_stats(t_render *render, t_perf_text *params)
+{
+	t_frame_cache	*cache;
+	char			buf[16];
+	char			misses[16];
+
+	cache = &render->frame_cache;
+	ft_itoa_buf(buf, (int)cache->hits);
+	misses[0] = '/';
+	ft_itoa_buf(misses + 1, (int)cache->misses);
+	params->prefix = "Frame cache hit/miss: ";
+	params->value = buf;
+	params->suffix = misses;
+	hud_print_perf_line(render, params);
+	ft_itoa_buf(buf, (int)(cache->bytes >> 20));
+	params->prefix = "Frame cache: ";
+	params->suffix = " MB";
+	hud_print_perf_line(render, params);
+}
+
+/**
+ * @brief hud render perf stats 함수 - 렌더링 수행
+ *
+ * 히트 포인트당 평균 그림자 샘플 수, 차폐물 캐시 적중률,
+ * 광선 묶음 레인 활용률, 다시 그린 화면 비율, 프레임 캐시 통계, 직전 HUD 갱신 시간을
+ * 출력한다.
+ *
+ * @param render 파라미터
+ * @param y 파라미터
+ */
+void	hud_render_perf_stats(t_render *render, int *y)
+{
+	t_metrics	*m;
+	char		buf[64];
+	t_perf_text	params;
+
+	m = &render->scene->render_state.metrics;
+	params.y = y;
+	hud_format_float(buf, calculate_avg_shadow_samples(m));
+	params.prefix = "Shadow: ";
+	params.value = buf;
+	params.suffix = " spp";
+	hud_print_perf_line(render, &params);
+	hud_format_float(buf, calculate_shadow_cache_rate(m));
+	params.prefix = "Occluder cache: ";
+	params.value = buf;
+	params.suffix = "%";
+	hud_print_perf_line(render, &params);
+	render_packet_stat(render, &params);
+	render_redraw_stat(render, &params);
+	render_frame_cache_stats(render, &params);
+	hud_format_time_ms(buf, m->hud_time_us);
+	params.prefix = "HUD refresh: ";
+	params.value = buf;
+	params.suffix = "ms";
+	hud_print_perf_line(render, &params);
+}
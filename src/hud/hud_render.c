@@ -48,7 +48,7 @@ void	hud_render(t_render *render)
 {
 	if (!render->hud.visible)
 		return ;
-	hud_render_background(render);
+	overlay_fill(&render->hud.layer, HUD_COLOR_BG, HUD_BG_ALPHA);
 	hud_render_content(render);
 	render->hud.dirty = 0;
 }
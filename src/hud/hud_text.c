@@ -24,48 +24,17 @@ void	hud_mark_dirty(t_render *render)
 }
 
 /**
- * @brief hud render background row 함수 - 렌더링 수행
+ * @brief hud put text 함수 - HUD 레이어에 한 줄 그리기
  *
  * @param render 파라미터
- * @param y 파라미터
+ * @param y 기준선 y 좌표 (윈도우 좌표)
+ * @param color 파라미터
+ * @param str 파라미터
  */
-void	hud_render_background_row(t_render *render, int y)
+void	hud_put_text(t_render *render, int y, int color, char *str)
 {
-	int				x;
-	int				scene_color;
-	int				blended;
-	t_pixel_params	params;
-
-	x = HUD_MARGIN_X;
-	params.img_data = render->img_data;
-	params.y = y;
-	params.size_line = render->size_line;
-	params.bpp = render->bpp;
-	while (x < HUD_MARGIN_X + HUD_WIDTH)
-	{
-		params.x = x;
-		scene_color = get_pixel(&params);
-		blended = blend_colors(scene_color, HUD_COLOR_BG, HUD_BG_ALPHA);
-		set_pixel(&params, blended);
-		x++;
-	}
-}
-
-/**
- * @brief hud render background 함수 - 렌더링 수행
- *
- * @param render 파라미터
- */
-void	hud_render_background(t_render *render)
-{
-	int	y;
-
-	y = HUD_MARGIN_Y;
-	while (y < HUD_MARGIN_Y + HUD_HEIGHT)
-	{
-		hud_render_background_row(render, y);
-		y++;
-	}
+	overlay_text(&render->hud.layer,
+		(t_text_pen){HUD_MARGIN_X + 10, y, color}, str);
 }
 
 void	format_and_print_vec3(t_render *render, int *y,
@@ -81,8 +50,7 @@ void	format_and_print_vec3(t_render *render, int *y,
 		buf[i++] = *label++;
 	buf[i] = '\0';
 	hud_format_vec3(buf + i, vec);
-	mlx_string_put(render->mlx, render->win, HUD_MARGIN_X + 10,
-		*y, HUD_COLOR_TEXT, buf);
+	hud_put_text(render, *y, HUD_COLOR_TEXT, buf);
 	*y += HUD_LINE_HEIGHT;
 }
 
@@ -21,10 +21,6 @@
  */
 void	keyguide_cleanup(t_keyguide_state *keyguide, void *mlx)
 {
-	if (keyguide->bg_img)
-	{
-		mlx_destroy_image(mlx, keyguide->bg_img);
-		keyguide->bg_img = NULL;
-		keyguide->bg_data = NULL;
-	}
+	(void)mlx;
+	overlay_free(&keyguide->layer);
 }
@@ -25,13 +25,14 @@
 int	keyguide_init(t_keyguide_state *keyguide, void *mlx, void *win)
 {
 	(void)win;
-	keyguide->bg_img = mlx_new_image(mlx, KEYGUIDE_WIDTH, KEYGUIDE_HEIGHT);
-	if (!keyguide->bg_img)
+	(void)mlx;
+	if (overlay_init(&keyguide->layer, KEYGUIDE_WIDTH, KEYGUIDE_HEIGHT) == -1)
 		return (-1);
-	keyguide->bg_data = mlx_get_data_addr(keyguide->bg_img,
-			&keyguide->bpp, &keyguide->size_line, &keyguide->endian);
 	keyguide->x = WINDOW_WIDTH - KEYGUIDE_WIDTH - KEYGUIDE_MARGIN_X;
 	keyguide->y = KEYGUIDE_MARGIN_Y;
+	keyguide->layer.x = keyguide->x;
+	keyguide->layer.y = keyguide->y;
+	overlay_fill(&keyguide->layer, KEYGUIDE_COLOR_BG, KEYGUIDE_BG_ALPHA);
 	keyguide->visible = 1;
 	return (0);
 }
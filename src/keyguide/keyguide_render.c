@@ -15,37 +15,17 @@
 #include "window.h"
 
 /**
- * @brief keyguide render background 함수 - 렌더링 수행
+ * @brief keyguide put text 함수 - 키 가이드 레이어에 한 줄 그리기
  *
  * @param render 파라미터
+ * @param indent 패널 왼쪽 기준 x 오프셋
+ * @param y 기준선 y 좌표 (윈도우 좌표)
+ * @param str 파라미터
  */
-void	keyguide_render_background(t_render *render)
+static void	keyguide_put_text(t_render *render, int indent, int y, char *str)
 {
-	int				x;
-	int				y;
-	int				scene_color;
-	int				blended;
-	t_pixel_params	params;
-
-	y = render->keyguide.y;
-	while (y < render->keyguide.y + KEYGUIDE_HEIGHT)
-	{
-		x = render->keyguide.x;
-		while (x < render->keyguide.x + KEYGUIDE_WIDTH)
-		{
-			params.img_data = render->img_data;
-			params.x = x;
-			params.y = y;
-			params.size_line = render->size_line;
-			params.bpp = render->bpp;
-			scene_color = get_pixel(&params);
-			blended = blend_colors(scene_color, KEYGUIDE_COLOR_BG,
-					KEYGUIDE_BG_ALPHA);
-			set_pixel(&params, blended);
-			x++;
-		}
-		y++;
-	}
+	overlay_text(&render->keyguide.layer, (t_text_pen){render->keyguide.x
+		+ indent, y, KEYGUIDE_COLOR_TEXT}, str);
 }
 
 /**
@@ -56,23 +36,17 @@ void	keyguide_render_background(t_render *render)
  */
 static void	keyguide_render_camera_section(t_render *render, int *y)
 {
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 10, *y, KEYGUIDE_COLOR_TEXT, "Camera:");
+	keyguide_put_text(render, 10, *y, "Camera:");
 	*y += KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 20, *y, KEYGUIDE_COLOR_TEXT, "W/X - Fwd/Back");
+	keyguide_put_text(render, 20, *y, "W/X - Fwd/Back");
 	*y += KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 20, *y, KEYGUIDE_COLOR_TEXT, "A/D - Left/Right");
+	keyguide_put_text(render, 20, *y, "A/D - Left/Right");
 	*y += KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 20, *y, KEYGUIDE_COLOR_TEXT, "Q/Z - Up/Down");
+	keyguide_put_text(render, 20, *y, "Q/Z - Up/Down");
 	*y += KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 20, *y, KEYGUIDE_COLOR_TEXT, "E/C - Pitch");
+	keyguide_put_text(render, 20, *y, "E/C - Pitch");
 	*y += KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 20, *y, KEYGUIDE_COLOR_TEXT, "S - Reset");
+	keyguide_put_text(render, 20, *y, "S - Reset");
 }
 
 /**
@@ -85,17 +59,14 @@ void	keyguide_render_content(t_render *render)
 	int	y;
 
 	y = render->keyguide.y + 20;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 10, y, KEYGUIDE_COLOR_HEADING, "CONTROLS");
+	overlay_text(&render->keyguide.layer, (t_text_pen){render->keyguide.x
+		+ 10, y, KEYGUIDE_COLOR_HEADING}, "CONTROLS");
 	y += 30;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 10, y, KEYGUIDE_COLOR_TEXT, "Navigation:");
+	keyguide_put_text(render, 10, y, "Navigation:");
 	y += KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 20, y, KEYGUIDE_COLOR_TEXT, "ESC - Exit");
+	keyguide_put_text(render, 20, y, "ESC - Exit");
 	y += KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 20, y, KEYGUIDE_COLOR_TEXT, "H - Toggle HUD");
+	keyguide_put_text(render, 20, y, "H - Toggle HUD");
 	y += KEYGUIDE_SECTION_GAP + KEYGUIDE_LINE_HEIGHT;
 	keyguide_render_camera_section(render, &y);
 }
@@ -109,43 +80,38 @@ void	keyguide_render_content(t_render *render)
 void	keyguide_render_content2(t_render *render, int *y)
 {
 	*y += KEYGUIDE_SECTION_GAP + KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 10, *y, KEYGUIDE_COLOR_TEXT, "Objects:");
+	keyguide_put_text(render, 10, *y, "Objects:");
+	*y += KEYGUIDE_LINE_HEIGHT;
+	keyguide_put_text(render, 20, *y, "TAB - Next");
 	*y += KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 20, *y, KEYGUIDE_COLOR_TEXT, "TAB - Next");
+	keyguide_put_text(render, 20, *y, "[] - Select");
 	*y += KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 20, *y, KEYGUIDE_COLOR_TEXT, "[] - Select");
+	keyguide_put_text(render, 20, *y, "J - Jump to id");
 	*y += KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 20, *y, KEYGUIDE_COLOR_TEXT, "R/T - X axis");
+	keyguide_put_text(render, 20, *y, "R/T - X axis");
 	*y += KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 20, *y, KEYGUIDE_COLOR_TEXT, "F/G - Y axis");
+	keyguide_put_text(render, 20, *y, "F/G - Y axis");
 	*y += KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 20, *y, KEYGUIDE_COLOR_TEXT, "V/B - Z axis");
+	keyguide_put_text(render, 20, *y, "V/B - Z axis");
 	*y += KEYGUIDE_SECTION_GAP + KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 10, *y, KEYGUIDE_COLOR_TEXT, "Display:");
+	keyguide_put_text(render, 10, *y, "Display:");
 	*y += KEYGUIDE_LINE_HEIGHT;
-	mlx_string_put(render->mlx, render->win,
-		render->keyguide.x + 20, *y, KEYGUIDE_COLOR_TEXT, "I - Info");
+	keyguide_put_text(render, 20, *y, "I - Info");
+	*y += KEYGUIDE_LINE_HEIGHT;
+	keyguide_put_text(render, 20, *y, "N - BVH width");
 }
 
 /**
  * @brief keyguide render 함수 - 렌더링 수행
  *
+ * 키 가이드 내용은 고정이므로 초기화 시 레이어에 한 번만 그린다.
+ *
  * @param render 파라미터
  */
 void	keyguide_render(t_render *render)
 {
 	int	y;
 
-	if (!render->keyguide.visible)
-		return ;
-	keyguide_render_background(render);
 	keyguide_render_content(render);
 	y = render->keyguide.y + 20 + 30 + KEYGUIDE_LINE_HEIGHT * 7
 		+ KEYGUIDE_SECTION_GAP + KEYGUIDE_LINE_HEIGHT * 3;
@@ -14,7 +14,7 @@
 #include "vec3.h"
 #include "ray.h"
 #include "shadow.h"
-#include <math.h>
+#include <tgmath.h>
 
 /*
 ** Clamp color values to valid range [0, 255].
@@ -39,40 +39,40 @@ static void	clamp_color(t_color *result)
 ** Calculate specular reflection (Phong model).
 ** Creates shiny highlights on surfaces.
 */
-static double	calculate_specular(t_vec3 light_dir, t_vec3 normal,
+static t_real	calculate_specular(t_vec3 light_dir, t_vec3 normal,
 		t_vec3 view_dir)
 {
 	t_vec3	reflect_dir;
-	double	spec;
-	double	dot_ln;
+	t_real	spec;
+	t_real	dot_ln;
 
 	dot_ln = vec3_dot(light_dir, normal);
-	reflect_dir = vec3_subtract(vec3_multiply(normal, 2.0 * dot_ln),
+	reflect_dir = vec3_subtract(vec3_multiply(normal, 2 * dot_ln),
 			light_dir);
 	spec = vec3_dot(reflect_dir, view_dir);
-	if (spec < 0.0)
+	if (spec < 0)
 		spec = 0.0;
-	spec = pow(spec, 32.0);
+	spec = pow(spec, (t_real)32);
 	return (spec);
 }
 
 /*
 ** Calculate combined lighting factor (diffuse + specular - shadow).
 */
-static double	calc_lighting_factor(t_scene *scene, t_hit *hit,
+static t_real	calc_lighting_factor(t_scene *scene, t_hit *hit,
 		t_vec3 light_dir, t_vec3 view_dir)
 {
-	double	diffuse;
-	double	specular;
-	double	shadow_factor;
+	t_real	diffuse;
+	t_real	specular;
+	t_real	shadow_factor;
 
 	diffuse = vec3_dot(hit->normal, light_dir);
 	if (diffuse < 0)
 		diffuse = 0;
 	shadow_factor = calculate_shadow_factor(scene, hit->point,
 			scene->light.position, &scene->shadow_config);
-	specular = calculate_specular(light_dir, hit->normal, view_dir) * 0.5;
-	return ((diffuse + specular) * (1.0 - shadow_factor));
+	specular = calculate_specular(light_dir, hit->normal, view_dir) / 2;
+	return ((diffuse + specular) * (1 - shadow_factor));
 }
 
 /*
@@ -92,7 +92,7 @@ t_color	apply_lighting(t_scene *scene, t_hit *hit)
 {
 	t_vec3	light_dir;
 	t_vec3	view_dir;
-	double	lighting_factor;
+	t_real	lighting_factor;
 	t_color	result;
 
 	light_dir = vec3_normalize(vec3_subtract(scene->light.position,
@@ -100,18 +100,18 @@ t_color	apply_lighting(t_scene *scene, t_hit *hit)
 	view_dir = vec3_normalize(vec3_subtract(scene->camera.position,
 				hit->point));
 	lighting_factor = calc_lighting_factor(scene, hit, light_dir, view_dir);
-	result.r = (hit->color.r / 255.0) * (scene->ambient.ratio
-			* (scene->ambient.color.r / 255.0)
+	result.r = (hit->color.r / (t_real)255) * (scene->ambient.ratio
+			* (scene->ambient.color.r / (t_real)255)
 			+ lighting_factor * scene->light.brightness
-			* (scene->light.color.r / 255.0)) * 255.0;
-	result.g = (hit->color.g / 255.0) * (scene->ambient.ratio
-			* (scene->ambient.color.g / 255.0)
+			* (scene->light.color.r / (t_real)255)) * 255;
+	result.g = (hit->color.g / (t_real)255) * (scene->ambient.ratio
+			* (scene->ambient.color.g / (t_real)255)
 			+ lighting_factor * scene->light.brightness
-			* (scene->light.color.g / 255.0)) * 255.0;
-	result.b = (hit->color.b / 255.0) * (scene->ambient.ratio
-			* (scene->ambient.color.b / 255.0)
+			* (scene->light.color.g / (t_real)255)) * 255;
+	result.b = (hit->color.b / (t_real)255) * (scene->ambient.ratio
+			* (scene->ambient.color.b / (t_real)255)
 			+ lighting_factor * scene->light.brightness
-			* (scene->light.color.b / 255.0)) * 255.0;
+			* (scene->light.color.b / (t_real)255)) * 255;
 	clamp_color(&result);
 	return (result);
 }
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shadow_adaptive.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/21 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/21 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "shadow.h"
+#include <tgmath.h>
+
+/*
+** Probe grid size: sqrt(samples) sectors per ring (0 = adaptive disabled).
+*/
+static int	probe_grid(t_shadow_config *config)
+{
+	int	grid;
+
+	if (!config->adaptive)
+		return (0);
+	grid = (int)sqrt((t_real)config->samples);
+	if (grid < 2)
+		return (0);
+	return (grid);
+}
+
+/*
+** True if sample `index` belongs to the probe pass. Sample i lies in
+** ring i / grid and sector i % grid of the light disk. The probes are the
+** diagonal of that grid (sector = ring mod grid), so every ring and
+** sector holds one, plus the whole outer ring, where a penumbra
+** boundary usually enters the disk first.
+*/
+static int	is_probe_index(int index, int grid, int samples)
+{
+	return (grid && (index % grid == (index / grid) % grid
+			|| index / grid == (samples - 1) / grid));
+}
+
+/*
+** Number of probe indices among `samples`.
+*/
+static int	count_probes(int grid, int samples)
+{
+	int	probes;
+	int	i;
+
+	probes = 0;
+	i = 0;
+	while (i < samples)
+	{
+		probes += is_probe_index(i, grid, samples);
+		i++;
+	}
+	return (probes);
+}
+
+/*
+** Count occluded samples among the probe set (want_probe = 1)
+** or among the remaining samples (want_probe = 0).
+** The samples are tested in packets of up to SHADOW_PACKET_LANES rays.
+*/
+static int	count_occluded(t_shadow_sample *params, int grid, int want_probe)
+{
+	t_shadow_packet	packet;
+	int				occluded;
+	int				i;
+
+	packet.count = 0;
+	packet.active = 0;
+	packet.blocked = 0;
+	occluded = 0;
+	i = 0;
+	while (i < params->config->samples)
+	{
+		if (is_probe_index(i, grid, params->config->samples) == want_probe)
+			shadow_packet_add(params, &packet, i);
+		if (packet.count == SHADOW_PACKET_LANES)
+			occluded += shadow_packet_flush(params->scene, &packet);
+		i++;
+	}
+	return (occluded + shadow_packet_flush(params->scene, &packet));
+}
+
+/*
+** Adaptive soft-shadow sampling.
+** A few probe rays are cast first; if they all agree the point is fully
+** lit or fully occluded and the result is returned right away. Only
+** penumbra points pay for the full sample count (probe results reused).
+** Writes the number of rays actually cast to `fired`.
+*/
+t_real	shadow_sample_adaptive(t_shadow_sample *params, int *fired)
+{
+	int	grid;
+	int	probes;
+	int	occluded;
+
+	grid = probe_grid(params->config);
+	occluded = 0;
+	if (grid)
+	{
+		probes = count_probes(grid, params->config->samples);
+		occluded = count_occluded(params, grid, 1);
+		*fired = probes;
+		if (occluded == 0)
+			return (0.0);
+		if (occluded == probes)
+			return (1.0);
+	}
+	occluded += count_occluded(params, grid, 0);
+	*fired = params->config->samples;
+	return ((t_real)occluded / (t_real)params->config->samples);
+}
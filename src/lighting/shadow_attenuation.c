@@ -17,19 +17,19 @@
 ** Softens shadows based on distance from light source.
 ** Uses inverse square falloff with configurable softness.
 */
-double	calculate_shadow_attenuation(double distance, double max_distance,
-		double softness)
+t_real	calculate_shadow_attenuation(t_real distance, t_real max_distance,
+		t_real softness)
 {
-	double	normalized_dist;
-	double	attenuation;
+	t_real	normalized_dist;
+	t_real	attenuation;
 
-	if (max_distance <= 0.0)
+	if (max_distance <= 0)
 		return (1.0);
 	normalized_dist = distance / max_distance;
-	attenuation = 1.0 / (1.0 + normalized_dist * normalized_dist * softness);
-	if (attenuation < 0.0)
+	attenuation = 1 / (1 + normalized_dist * normalized_dist * softness);
+	if (attenuation < 0)
 		attenuation = 0.0;
-	if (attenuation > 1.0)
+	if (attenuation > 1)
 		attenuation = 1.0;
 	return (attenuation);
 }
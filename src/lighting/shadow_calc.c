@@ -6,32 +6,33 @@
 /*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/18 15:19:04 by yoshin            #+#    #+#             */
-/*   Updated: 2025/12/18 15:19:05 by yoshin           ###   ########.fr       */
+/*   Updated: 2026/01/21 10:00:00 by yoshin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "shadow.h"
 #include "minirt.h"
 #include "vec3.h"
-#include <math.h>
+#include "metrics.h"
+#include <tgmath.h>
 
 /*
 ** Calculate adaptive shadow bias based on surface angle.
 ** Increases bias for grazing angles to prevent shadow acne.
 ** Returns adjusted bias value scaled by angle factor.
 */
-double	calculate_shadow_bias(t_vec3 normal, t_vec3 light_dir,
-		double base_bias)
+t_real	calculate_shadow_bias(t_vec3 normal, t_vec3 light_dir,
+		t_real base_bias)
 {
-	double	dot_nl;
-	double	angle_factor;
-	double	bias;
+	t_real	dot_nl;
+	t_real	angle_factor;
+	t_real	bias;
 
 	dot_nl = vec3_dot(normal, light_dir);
-	if (dot_nl < 0.0)
+	if (dot_nl < 0)
 		dot_nl = -dot_nl;
-	angle_factor = 1.0 - dot_nl;
-	bias = base_bias * (1.0 + angle_factor * 2.0);
+	angle_factor = 1 - dot_nl;
+	bias = base_bias * (1 + angle_factor * 2);
 	return (bias);
 }
 
@@ -39,23 +40,24 @@ double	calculate_shadow_bias(t_vec3 normal, t_vec3 light_dir,
 ** Generate offset vector for soft shadow sampling.
 ** Uses stratified sampling in circular pattern around light.
 ** Returns zero vector if only one sample requested.
+** Fallback for sample counts the precomputed tables do not cover.
 */
-t_vec3	generate_shadow_sample_offset(double radius, int sample_index,
+t_vec3	generate_shadow_sample_offset(t_real radius, int sample_index,
 		int total_samples)
 {
 	t_vec3	offset;
-	double	angle;
-	double	r;
+	t_real	angle;
+	t_real	r;
 	int		grid_size;
 
 	if (total_samples <= 1)
 		return ((t_vec3){0.0, 0.0, 0.0});
-	grid_size = (int)sqrt((double)total_samples);
+	grid_size = (int)sqrt((t_real)total_samples);
 	if (grid_size < 1)
 		grid_size = 1;
-	angle = 2.0 * 3.14159265358979323846 * (sample_index % grid_size)
-		/ (double)grid_size;
-	r = radius * (sample_index / (double)grid_size + 0.5) / (double)grid_size;
+	angle = 2 * (t_real)3.14159265358979323846 * (sample_index % grid_size)
+		/ (t_real)grid_size;
+	r = radius * (sample_index / (t_real)grid_size + (t_real)0.5) / (t_real)grid_size;
 	offset.x = r * cos(angle);
 	offset.y = r * sin(angle);
 	offset.z = 0.0;
@@ -63,68 +65,28 @@ t_vec3	generate_shadow_sample_offset(double radius, int sample_index,
 }
 
 /*
-** Cast single shadow ray with offset.
-*/
-/**
- * @brief sample shadow ray 함수
- *
- * @param params 파라미터
- * @param index 파라미터
- *
- * @return int 반환값
- */
-static int	sample_shadow_ray(t_shadow_sample *params, int index)
-{
-	t_vec3	offset;
-	t_vec3	sample_light_pos;
-
-	offset = generate_shadow_sample_offset(params->config->softness * 2.0,
-			index, params->config->samples);
-	sample_light_pos = vec3_add(params->light_pos, offset);
-	return (is_in_shadow(params->scene, params->point,
-			sample_light_pos, params->bias));
-}
-
-/*
-** Calculate shadow samples by casting rays to light positions.
+** Calculate shadow factor using multiple shadow rays.
+** Casts multiple rays to determine partial occlusion; the adaptive
+** sampler stops after the probe pass when the point is not in a penumbra.
+** Returns 0.0 (fully lit) to 1.0 (fully shadowed).
 */
-static double	calc_shadow_samples(t_scene *scene, t_vec3 point,
+t_real	calculate_shadow_factor(t_scene *scene, t_vec3 point,
 		t_vec3 light_pos, t_shadow_config *config)
 {
 	t_shadow_sample	params;
-	double			shadow_count;
-	t_vec3			normal;
 	t_vec3			light_dir;
-	int				i;
+	t_real			factor;
+	int				fired;
 
-	shadow_count = 0.0;
 	light_dir = vec3_normalize(vec3_subtract(light_pos, point));
-	normal = (t_vec3){0.0, 1.0, 0.0};
 	params.scene = scene;
+	params.table = &scene->shadow_table;
 	params.point = point;
 	params.light_pos = light_pos;
 	params.config = config;
-	params.bias = calculate_shadow_bias(normal, light_dir, 0.001);
-	i = 0;
-	while (i < config->samples)
-	{
-		if (sample_shadow_ray(&params, i))
-			shadow_count += 1.0;
-		i++;
-	}
-	return (shadow_count);
-}
-
-/*
-** Calculate shadow factor using multiple shadow rays.
-** Casts multiple rays to determine partial occlusion.
-** Returns 0.0 (fully lit) to 1.0 (fully shadowed).
-*/
-double	calculate_shadow_factor(t_scene *scene, t_vec3 point,
-		t_vec3 light_pos, t_shadow_config *config)
-{
-	double	shadow_count;
-
-	shadow_count = calc_shadow_samples(scene, point, light_pos, config);
-	return (shadow_count / (double)config->samples);
+	params.bias = calculate_shadow_bias((t_vec3){0.0, 1.0, 0.0}, light_dir,
+			SHADOW_BIAS);
+	factor = shadow_sample_adaptive(&params, &fired);
+	metrics_add_shadow_samples(&scene->render_state.metrics, fired);
+	return (factor);
 }
@@ -16,6 +16,7 @@
 ** Initialize shadow configuration with default values.
 ** 16 samples for soft shadows with subtle edge softness.
 ** Bias scale of 2.0 prevents shadow acne artifacts.
+** Adaptive sampling skips the full sample count outside penumbrae.
 */
 /**
  * @brief init shadow config 함수 - 초기화 수행
@@ -30,6 +31,7 @@ t_shadow_config	init_shadow_config(void)
 	config.softness = 0.3;
 	config.bias_scale = 2.0;
 	config.enable_ao = 0;
+	config.adaptive = 1;
 	return (config);
 }
 
@@ -50,9 +52,9 @@ int	validate_shadow_config(t_shadow_config *config)
 		return (0);
 	if (config->samples < 1)
 		return (0);
-	if (config->softness < 0.0 || config->softness > 1.0)
+	if (config->softness < 0 || config->softness > 1)
 		return (0);
-	if (config->bias_scale < 0.0)
+	if (config->bias_scale < 0)
 		return (0);
 	return (1);
 }
@@ -83,8 +85,8 @@ void	set_shadow_samples(t_shadow_config *config, int samples)
  * @param config 파라미터
  * @param softness 파라미터
  */
-void	set_shadow_softness(t_shadow_config *config, double softness)
+void	set_shadow_softness(t_shadow_config *config, t_real softness)
 {
-	if (config && softness >= 0.0 && softness <= 1.0)
+	if (config && softness >= 0 && softness <= 1)
 		config->softness = softness;
 }
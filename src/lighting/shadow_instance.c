@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shadow_instance.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/08 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/08 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "shadow.h"
+#include "minirt.h"
+#include "window.h"
+
+/**
+ * @brief shadow hits instance 함수 - 인스턴스 차폐 검사
+ *
+ * 그림자 광선을 그룹 공간으로 옮겨 그룹 BVH에서 max / scale 이내의
+ * 교차를 찾는다 (instance_ray의 원점 이동만큼 더한다). 광원 샘플에서
+ * 월드 거리 HIT_EPSILON 이내의 교차는 무시한다.
+ *
+ * @param scene 파라미터
+ * @param i 인스턴스 인덱스
+ * @param ray 그림자 광선
+ *
+ * @return int 가리면 1
+ */
+int	shadow_hits_instance(t_scene *scene, int i, t_shadow_ray *ray)
+{
+	t_instance	*inst;
+	t_hit		local;
+	t_real		bound;
+
+	inst = &scene->instances[i];
+	bound = ray->max / inst->scale + instance_shift(inst);
+	local.distance = bound;
+	return (bvh_intersect(scene->groups[inst->group].bvh,
+			instance_ray(inst, vec3_add(scene->shadow_light.origin,
+					ray->offset), ray->dir), &local, scene)
+		&& local.distance <= bound);
+}
+
+/**
+ * @brief shadow hits mesh 함수 - 메시 차폐 검사
+ *
+ * 그림자 광선을 메시 좌표로 옮겨 메시 BVH에서 max 이내의 첫 교차를
+ * 찾는다 (가장 가까운 교차는 필요 없다).
+ *
+ * @param scene 파라미터
+ * @param i 메시 인덱스
+ * @param ray 그림자 광선
+ *
+ * @return int 가리면 1
+ */
+int	shadow_hits_mesh(t_scene *scene, int i, t_shadow_ray *ray)
+{
+	t_ray		wray;
+	t_mesh_ray	mray;
+
+	wray.origin = vec3_add(scene->shadow_light.origin, ray->offset);
+	wray.direction = ray->dir;
+	mesh_ray_init(&scene->meshes[i], &wray, ray->max, &mray);
+	return (mesh_traverse(&scene->meshes[i], &mray, 1) >= 0);
+}
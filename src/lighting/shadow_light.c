@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shadow_light.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/30 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/30 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "shadow.h"
+#include "minirt.h"
+#include "vec3.h"
+#include "window.h"
+#include <tgmath.h>
+
+/**
+ * @brief shadow frame prepare 함수 - 프레임별 그림자 사전 계산
+ *
+ * 광원 기준 항(L - C, |L - C|² - r², 축/법선 성분)을 객체마다 한 번만
+ * 계산해 두고 모든 그림자 광선이 공유한다.
+ *
+ * @param scene 파라미터
+ */
+void	shadow_frame_prepare(t_scene *scene)
+{
+	shadow_table_update(&scene->shadow_table, scene->shadow_config.samples);
+	origin_terms_update(&scene->shadow_light, scene, scene->light.position);
+}
+
+/**
+ * @brief shadow ray init 함수 - 광원 샘플에서 점으로 향하는 그림자 광선
+ *
+ * [-bias, dist - bias - HIT_EPSILON] 구간은 bias만큼 띄운 점에서
+ * 광원 쪽 [HIT_EPSILON, dist] 구간과 같은 선분이다.
+ *
+ * @param params 점, bias, 장면
+ * @param light_pos 광원 샘플 위치
+ * @param ray 출력 그림자 광선
+ *
+ * @return int 점이 광원 샘플 위에 있으면 0 (가려질 수 없음), 아니면 1
+ */
+int	shadow_ray_init(t_shadow_sample *params, t_vec3 light_pos,
+		t_shadow_ray *ray)
+{
+	t_vec3	to_point;
+	t_real	dist;
+
+	to_point = vec3_subtract(params->point, light_pos);
+	dist = vec3_magnitude(to_point);
+	if (dist < EPSILON)
+		return (0);
+	ray->offset = vec3_subtract(light_pos,
+			params->scene->shadow_light.origin);
+	ray->offset_sq = vec3_dot(ray->offset, ray->offset);
+	ray->dir = vec3_multiply(to_point, 1 / dist);
+	ray->min = -params->bias;
+	ray->max = dist - params->bias - HIT_EPSILON;
+	return (1);
+}
+
+/**
+ * @brief shadow hits object 함수 - 종류별 차폐 검사 분기
+ *
+ * @param scene 파라미터
+ * @param type 객체 종류
+ * @param index 객체 인덱스
+ * @param ray 그림자 광선
+ *
+ * @return int 가리면 1, 없는 객체이면 0
+ */
+int	shadow_hits_object(t_scene *scene, int type, int index,
+		t_shadow_ray *ray)
+{
+	if (type == OBJ_SPHERE && index < scene->sphere_count)
+		return (shadow_hits_sphere(scene, index, ray));
+	if (type == OBJ_PLANE && index < scene->plane_count)
+		return (shadow_hits_plane(scene, index, ray));
+	if (type == OBJ_CYLINDER && index < scene->cylinder_count)
+		return (shadow_hits_cylinder(scene, index, ray));
+	if (type == OBJ_INSTANCE && index < scene->instance_count)
+		return (shadow_hits_instance(scene, index, ray));
+	if (type == OBJ_MESH && index < scene->mesh_count)
+		return (shadow_hits_mesh(scene, index, ray));
+	return (0);
+}
+
+/**
+ * @brief shadow hits sphere 함수 - 구 차폐 검사
+ *
+ * 원점이 광원 샘플(L + offset)이므로 광원 기준 oc에 offset을 더하고,
+ * |oc + offset|² - r² = c + 2 offset·oc + |offset|² 로 사전 계산 항을
+ * 재사용한다. 방향이 단위 벡터라 a = 1이다.
+ *
+ * @param scene 파라미터
+ * @param i 구 인덱스
+ * @param ray 그림자 광선
+ *
+ * @return int 가리면 1
+ */
+int	shadow_hits_sphere(t_scene *scene, int i, t_shadow_ray *ray)
+{
+	t_origin_term	*term;
+	t_real			b;
+	t_real			disc;
+	t_real			u;
+
+	term = &scene->shadow_light.spheres[i];
+	b = vec3_dot(vec3_add(term->oc, ray->offset), ray->dir);
+	disc = b * b - (term->c + 2 * vec3_dot(ray->offset, term->oc)
+			+ ray->offset_sq);
+	if (disc < 0)
+		return (0);
+	disc = sqrt(disc);
+	u = -b - disc;
+	if (u >= ray->min && u <= ray->max)
+		return (1);
+	u = -b + disc;
+	return (u >= ray->min && u <= ray->max);
+}
+
+/**
+ * @brief shadow hits plane 함수 - 평면 차폐 검사
+ *
+ * @param scene 파라미터
+ * @param i 평면 인덱스
+ * @param ray 그림자 광선
+ *
+ * @return int 가리면 1
+ */
+int	shadow_hits_plane(t_scene *scene, int i, t_shadow_ray *ray)
+{
+	t_plane	*plane;
+	t_real	denom;
+	t_real	u;
+
+	plane = &scene->planes[i];
+	denom = vec3_dot(plane->normal, ray->dir);
+	if (fabs(denom) < PARALLEL_EPSILON)
+		return (0);
+	u = -(scene->shadow_light.planes[i].oc_axis
+			+ vec3_dot(plane->normal, ray->offset)) / denom;
+	return (u >= ray->min && u <= ray->max);
+}
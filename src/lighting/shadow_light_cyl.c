@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shadow_light_cyl.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/30 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/30 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "shadow.h"
+#include "minirt.h"
+#include "vec3.h"
+#include <tgmath.h>
+
+/*
+** Side surface: both roots of the infinite cylinder in calc->body (the
+** whole line for a ray along the axis that starts inside).
+** q: a, half b, c
+*/
+static int	body_range(t_origin_term *term, t_cylinder *cyl,
+		t_shadow_ray *ray, t_cyl_calc *calc)
+{
+	t_real	q[3];
+	t_real	disc;
+
+	calc->da = vec3_dot(ray->dir, cyl->axis);
+	calc->oa = term->oc_axis + vec3_dot(ray->offset, cyl->axis);
+	q[0] = 1 - calc->da * calc->da;
+	q[1] = vec3_dot(ray->dir, vec3_add(term->oc, ray->offset))
+		- calc->da * calc->oa;
+	q[2] = term->c + 2 * vec3_dot(ray->offset, term->oc)
+		+ ray->offset_sq - calc->oa * calc->oa;
+	calc->body[0] = -INFINITY;
+	calc->body[1] = INFINITY;
+	if (q[0] < EPSILON)
+		return (q[2] <= 0);
+	disc = q[1] * q[1] - q[0] * q[2];
+	if (disc < 0)
+		return (0);
+	disc = sqrt(disc);
+	calc->body[0] = (-q[1] - disc) / q[0];
+	calc->body[1] = (-q[1] + disc) / q[0];
+	return (1);
+}
+
+/**
+ * @brief shadow hits cylinder 함수 - 원기둥 차폐 검사 (몸통 + 뚜껑)
+ *
+ * 몸통 구간과 뚜껑 평면 구간이 겹치는 곳이 원기둥 내부다. 그 양 끝
+ * (들어가고 나오는 면) 중 하나가 광선 범위 안이면 가린다.
+ *
+ * @param scene 파라미터
+ * @param i 원기둥 인덱스
+ * @param ray 그림자 광선
+ *
+ * @return int 가리면 1
+ */
+int	shadow_hits_cylinder(t_scene *scene, int i, t_shadow_ray *ray)
+{
+	t_cylinder	*cyl;
+	t_cyl_calc	calc;
+	t_real		lo;
+	t_real		hi;
+
+	cyl = &scene->cylinders[i];
+	if (!body_range(&scene->shadow_light.cylinders[i], cyl, ray, &calc)
+		|| !cylinder_slab(cyl, &calc))
+		return (0);
+	lo = fmax(calc.body[0], calc.slab[0]);
+	hi = fmin(calc.body[1], calc.slab[1]);
+	return (lo <= hi && ((lo >= ray->min && lo <= ray->max)
+			|| (hi >= ray->min && hi <= ray->max)));
+}
@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shadow_packet.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/02 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/02 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "shadow.h"
+#include "minirt.h"
+#include "vec3.h"
+#include "window.h"
+#include "metrics.h"
+
+/**
+ * @brief shadow packet object 함수 - 객체 하나를 레인 묶음으로 검사
+ *
+ * 빔 밖의 객체는 건너뛴다. 아직 가려지지 않은 레인만 검사하고, 가려진
+ * 레인은 빠진다. 캐시된 차폐물이었다면 캐시 적중으로 세고,
+ * 가린 객체가 새 캐시 차폐물이 된다.
+ *
+ * @param scene 파라미터
+ * @param p 그림자 광선 묶음
+ * @param ref 객체 (종류, 인덱스)
+ */
+void	shadow_packet_object(t_scene *scene, t_shadow_packet *p,
+		t_object_ref ref)
+{
+	t_metrics	*m;
+	int			cached;
+	int			lane;
+
+	if (shadow_packet_culled(scene, p, ref.type, ref.index))
+		return ;
+	m = &scene->render_state.metrics;
+	metrics_add_packet(m, p->active, p->count);
+	cached = (scene->shadow_cache.type == ref.type
+			&& scene->shadow_cache.index == ref.index);
+	lane = 0;
+	while (lane < p->count)
+	{
+		if ((p->active & (1 << lane))
+			&& shadow_hits_object(scene, ref.type, ref.index, &p->ray[lane]))
+		{
+			p->active &= ~(1 << lane);
+			p->blocked++;
+			metrics_add_shadow_cache(m, cached);
+			scene->shadow_cache.type = ref.type;
+			scene->shadow_cache.index = ref.index;
+		}
+		lane++;
+	}
+}
+
+/*
+** Test the objects of one type until every lane is blocked (no scene BVH).
+*/
+static void	scan_type(t_scene *scene, t_shadow_packet *p, int type,
+		int count)
+{
+	int	i;
+
+	i = 0;
+	while (i < count && p->active)
+	{
+		shadow_packet_object(scene, p, (t_object_ref){type, i});
+		i++;
+	}
+}
+
+/**
+ * @brief shadow packet add 함수 - 샘플 광선을 다음 레인에 추가
+ *
+ * 첫 레인에서 묶음의 빔 (광원 중심에서 점까지의 선분과 반경)을
+ * 정한다. 점이 광원 샘플 위에 있으면 가려질 수 없으므로 레인을
+ * 비활성으로 둔다 (밝음).
+ *
+ * @param params 그림자 샘플링 파라미터
+ * @param packet 그림자 광선 묶음
+ * @param index 샘플 인덱스
+ */
+void	shadow_packet_add(t_shadow_sample *params, t_shadow_packet *packet,
+		int index)
+{
+	t_vec3	offset;
+
+	if (packet->count == 0)
+	{
+		packet->seg = vec3_subtract(params->point, params->light_pos);
+		packet->seg_sq = vec3_dot(packet->seg, packet->seg);
+		packet->reach = params->config->softness * 2 + params->bias
+			+ HIT_EPSILON;
+	}
+	offset = shadow_table_offset(params->table,
+			params->config->softness * 2, index, params->config->samples);
+	if (shadow_ray_init(params, vec3_add(params->light_pos, offset),
+			&packet->ray[packet->count]))
+		packet->active |= 1 << packet->count;
+	packet->count++;
+}
+
+/**
+ * @brief shadow packet flush 함수 - 묶음 차폐 검사
+ *
+ * 캐시된 차폐물을 먼저 검사한 뒤 활성 레인 마스크를 들고 장면 BVH를
+ * 내려간다 (shadow_packet_bvh). BVH가 없으면 구, 평면, 원기둥,
+ * 인스턴스, 메시 순으로 객체마다 남은 레인을 검사한다. 모든 레인이
+ * 가려지면 멈춘다.
+ *
+ * @param scene 파라미터
+ * @param packet 그림자 광선 묶음 (검사 후 비워진다)
+ *
+ * @return int 가려진 레인 수
+ */
+int	shadow_packet_flush(t_scene *scene, t_shadow_packet *packet)
+{
+	int	blocked;
+
+	if (packet->active && scene->shadow_cache.type != OBJ_NONE)
+		shadow_packet_object(scene, packet, (t_object_ref){
+			scene->shadow_cache.type, scene->shadow_cache.index});
+	if (!shadow_packet_bvh(scene, packet))
+	{
+		scan_type(scene, packet, OBJ_SPHERE, scene->sphere_count);
+		scan_type(scene, packet, OBJ_PLANE, scene->plane_count);
+		scan_type(scene, packet, OBJ_CYLINDER, scene->cylinder_count);
+		scan_type(scene, packet, OBJ_INSTANCE, scene->instance_count);
+		scan_type(scene, packet, OBJ_MESH, scene->mesh_count);
+	}
+	blocked = packet->blocked;
+	packet->count = 0;
+	packet->active = 0;
+	packet->blocked = 0;
+	return (blocked);
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shadow_packet_bvh.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/10 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/10 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "shadow.h"
+#include "minirt.h"
+#include "vec3.h"
+#include "window.h"
+
+/*
+** Clip range to one slab; near / far are the box planes relative to the
+** ray origin. Plain comparisons keep the range when 0 * inf gives NaN
+** (origin on a box plane, direction parallel to it).
+*/
+static void	slab_axis(t_real *range, t_real near, t_real far, t_real inv)
+{
+	t_real	t0;
+	t_real	t1;
+	t_real	swap;
+
+	t0 = near * inv;
+	t1 = far * inv;
+	if (t0 > t1)
+	{
+		swap = t0;
+		t0 = t1;
+		t1 = swap;
+	}
+	if (t0 > range[0])
+		range[0] = t0;
+	if (t1 < range[1])
+		range[1] = t1;
+}
+
+/*
+** Whole-packet box test: every lane stays within reach of the segment
+** from the light center to the point (seg), so no lane enters a box the
+** segment misses once the box is grown by reach on every side.
+*/
+static int	beam_enters(t_scene *scene, t_shadow_packet *p, t_aabb *b)
+{
+	t_real	range[2];
+	t_vec3	o;
+	t_real	r;
+
+	o = scene->shadow_light.origin;
+	r = p->reach;
+	range[0] = 0;
+	range[1] = 1;
+	slab_axis(range, b->min.x - r - o.x, b->max.x + r - o.x, p->seg_inv.x);
+	slab_axis(range, b->min.y - r - o.y, b->max.y + r - o.y, p->seg_inv.y);
+	slab_axis(range, b->min.z - r - o.z, b->max.z + r - o.z, p->seg_inv.z);
+	return (range[0] <= range[1]);
+}
+
+/*
+** Any-hit walk of the binary scene BVH. Each node is tested once for the
+** whole packet, leaf objects against the lanes still active; the walk
+** stops when every lane is blocked.
+*/
+static void	node_lanes(t_scene *scene, t_shadow_packet *p, t_bvh_node *node)
+{
+	int	i;
+
+	if (!node || !p->active || !beam_enters(scene, p, &node->bounds))
+		return ;
+	i = 0;
+	while (i < node->object_count && p->active)
+	{
+		shadow_packet_object(scene, p, node->objects[i]);
+		i++;
+	}
+	node_lanes(scene, p, node->left);
+	node_lanes(scene, p, node->right);
+}
+
+/**
+ * @brief shadow packet bvh 함수 - 그림자 광선 묶음의 장면 BVH 탐색
+ *
+ * 활성 레인 마스크를 들고 이진 장면 BVH를 내려간다. 노드 상자는
+ * 레인마다가 아니라 빔 (광원 중심에서 점까지의 선분, reach만큼 키운
+ * 상자)으로 묶음 전체에 한 번 검사한다. 빔이 지나는 잎의 객체만
+ * 검사하므로 객체 수에 비례하지 않는다.
+ *
+ * @param scene 파라미터
+ * @param p 그림자 광선 묶음
+ *
+ * @return int BVH가 없거나 꺼져 있으면 0 (호출자가 전체 검사)
+ */
+int	shadow_packet_bvh(t_scene *scene, t_shadow_packet *p)
+{
+	t_bvh	*bvh;
+
+	bvh = scene->render_state.bvh;
+	if (!bvh || !bvh->enabled || !bvh->root)
+		return (0);
+	p->seg_inv = (t_vec3){1 / p->seg.x, 1 / p->seg.y, 1 / p->seg.z};
+	node_lanes(scene, p, bvh->root);
+	return (1);
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shadow_packet_cull.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/02 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/02 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "shadow.h"
+#include "minirt.h"
+#include "vec3.h"
+#include "window.h"
+#include <tgmath.h>
+
+/*
+** True if a sphere (light-relative term oc = L - C) stays farther than
+** radius + reach from the segment from the light center L to the point.
+** Every lane runs from L + offset (|offset| <= disk radius) to the point,
+** extended by the bias, so it stays within reach of that segment.
+*/
+static int	beam_misses(t_shadow_packet *p, t_vec3 oc, t_real radius)
+{
+	t_vec3	cl;
+	t_real	t;
+
+	if (p->seg_sq < EPSILON)
+		return (0);
+	cl = vec3_multiply(oc, -1.0);
+	t = vec3_dot(cl, p->seg) / p->seg_sq;
+	if (t < 0)
+		t = 0.0;
+	if (t > 1)
+		t = 1.0;
+	cl = vec3_subtract(cl, vec3_multiply(p->seg, t));
+	radius += p->reach;
+	return (vec3_dot(cl, cl) > radius * radius);
+}
+
+/*
+** Instances and meshes: bounding sphere of their world box.
+*/
+static int	nested_misses(t_scene *scene, t_shadow_packet *p, int type,
+		int index)
+{
+	t_vec3	center;
+	t_real	radius;
+
+	if (type == OBJ_INSTANCE)
+	{
+		if (index >= scene->instance_count)
+			return (1);
+		center = scene->instances[index].center;
+		radius = scene->instances[index].radius;
+	}
+	else
+	{
+		if (type != OBJ_MESH || index >= scene->mesh_count)
+			return (1);
+		center = scene->meshes[index].center;
+		radius = scene->meshes[index].radius;
+	}
+	return (beam_misses(p, vec3_subtract(scene->shadow_light.origin, center),
+			radius));
+}
+
+/**
+ * @brief shadow packet culled 함수 - 묶음 전체 차폐 검사 생략 판정
+ *
+ * 구는 그 자체로, 원기둥은 중심에서 sqrt(반지름² + (높이/2)²)인 경계 구로,
+ * 인스턴스와 메시는 경계 상자의 경계 구로 검사한다. 평면은 무한하므로 생략하지 않는다.
+ *
+ * @param scene 파라미터
+ * @param packet 그림자 광선 묶음
+ * @param type 객체 종류
+ * @param index 객체 인덱스
+ *
+ * @return int 어느 레인도 객체에 닿을 수 없으면 1
+ */
+int	shadow_packet_culled(t_scene *scene, t_shadow_packet *packet, int type,
+		int index)
+{
+	t_cylinder	*cyl;
+
+	if (type == OBJ_SPHERE)
+		return (index >= scene->sphere_count
+			|| beam_misses(packet, scene->shadow_light.spheres[index].oc,
+				scene->spheres[index].radius));
+	if (type == OBJ_CYLINDER)
+	{
+		if (index >= scene->cylinder_count)
+			return (1);
+		cyl = &scene->cylinders[index];
+		return (beam_misses(packet, scene->shadow_light.cylinders[index].oc,
+				sqrt(cyl->radius_squared
+					+ cyl->half_height * cyl->half_height)));
+	}
+	if (type >= OBJ_INSTANCE)
+		return (nested_misses(scene, packet, type, index));
+	return (type != OBJ_PLANE || index >= scene->plane_count);
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shadow_table.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/22 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/22 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "shadow.h"
+#include <tgmath.h>
+
+/*
+** 4x4 ordered-dither ranks: adjacent pixels get ranks far apart, so
+** their jitter (taken from a low-discrepancy sequence) differs most.
+*/
+static const int	g_tile_rank[SHADOW_TILE_COUNT] = {
+	0, 8, 2, 10,
+	12, 4, 14, 6,
+	3, 11, 1, 9,
+	15, 7, 13, 5
+};
+
+/**
+ * @brief frac real 함수 - 소수부 반환
+ *
+ * @param v 파라미터
+ *
+ * @return t_real 반환값
+ */
+static t_real	frac_real(t_real v)
+{
+	return (v - floor(v));
+}
+
+/*
+** Fill one tile slot with `samples` unit-disk offsets.
+** Strata: sqrt(samples) angular sectors per ring, rings equal in area
+** (r = sqrt(u)); sample i is in ring i / grid, sector i % grid.
+** The slot jitter is the R2 sequence point for its rank; each ring is
+** rotated by the golden ratio so sectors of adjacent rings interleave.
+*/
+static void	fill_tile(t_shadow_table *table, int tile, int samples)
+{
+	t_real	jitter[2];
+	t_real	uv[2];
+	int		grid;
+	int		rings;
+	int		i;
+
+	grid = (int)sqrt((t_real)samples);
+	rings = (samples + grid - 1) / grid;
+	jitter[0] = frac_real(0.5 + tile * 0.7548776662466927);
+	jitter[1] = frac_real(0.5 + tile * 0.5698402909980532);
+	i = 0;
+	while (i < samples)
+	{
+		uv[0] = sqrt((i / grid + jitter[0]) / (t_real)rings);
+		uv[1] = (t_real)6.28318530717958647692 * ((i % grid + jitter[1])
+				/ (t_real)grid + (i / grid) * (t_real)0.6180339887498949);
+		table->dx[tile][i] = uv[0] * cos(uv[1]);
+		table->dy[tile][i] = uv[0] * sin(uv[1]);
+		i++;
+	}
+}
+
+/*
+** Rebuild the sample tables when the sample count changed.
+** Counts above SHADOW_MAX_SAMPLES leave the table unbuilt (fallback path).
+*/
+void	shadow_table_update(t_shadow_table *table, int samples)
+{
+	int	tile;
+
+	if (table->samples == samples || samples > SHADOW_MAX_SAMPLES)
+		return ;
+	table->samples = 0;
+	if (samples <= 1)
+		return ;
+	tile = 0;
+	while (tile < SHADOW_TILE_COUNT)
+	{
+		fill_tile(table, tile, samples);
+		tile++;
+	}
+	table->samples = samples;
+}
+
+/**
+ * @brief shadow tile index 함수 - 픽셀의 샘플 테이블 슬롯 반환
+ *
+ * @param x 파라미터
+ * @param y 파라미터
+ *
+ * @return int 반환값
+ */
+int	shadow_tile_index(int x, int y)
+{
+	return (g_tile_rank[(y % SHADOW_TILE_SIZE) * SHADOW_TILE_SIZE
+			+ x % SHADOW_TILE_SIZE]);
+}
+
+/*
+** Table lookup of a shadow sample offset, scaled to the light radius.
+*/
+t_vec3	shadow_table_offset(t_shadow_table *table, t_real radius,
+		int index, int samples)
+{
+	if (samples <= 1)
+		return ((t_vec3){0.0, 0.0, 0.0});
+	if (table->samples != samples)
+		return (generate_shadow_sample_offset(radius, index, samples));
+	return ((t_vec3){table->dx[table->tile][index] * radius,
+		table->dy[table->tile][index] * radius, 0.0});
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mesh_box.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/09 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "mesh.h"
+#include <math.h>
+
+/**
+ * @brief mesh box empty 함수 - 빈 상자로 초기화
+ *
+ * @param bmin 최소 꼭짓점
+ * @param bmax 최대 꼭짓점
+ */
+void	mesh_box_empty(float *bmin, float *bmax)
+{
+	int	a;
+
+	a = 0;
+	while (a < 3)
+	{
+		bmin[a] = INFINITY;
+		bmax[a] = -INFINITY;
+		a++;
+	}
+}
+
+/**
+ * @brief mesh box grow 함수 - 상자에 다른 상자를 합침
+ *
+ * @param bmin 최소 꼭짓점
+ * @param bmax 최대 꼭짓점
+ * @param omin 합칠 상자의 최소 꼭짓점
+ * @param omax 합칠 상자의 최대 꼭짓점
+ */
+void	mesh_box_grow(float *bmin, float *bmax, float *omin, float *omax)
+{
+	int	a;
+
+	a = 0;
+	while (a < 3)
+	{
+		if (omin[a] < bmin[a])
+			bmin[a] = omin[a];
+		if (omax[a] > bmax[a])
+			bmax[a] = omax[a];
+		a++;
+	}
+}
+
+/**
+ * @brief mesh box area 함수 - 상자의 겉넓이의 절반 (SAH 비용)
+ *
+ * @param bmin 최소 꼭짓점
+ * @param bmax 최대 꼭짓점
+ *
+ * @return float 빈 상자이면 0
+ */
+float	mesh_box_area(float *bmin, float *bmax)
+{
+	float	d[3];
+
+	if (bmin[0] > bmax[0])
+		return (0.0f);
+	d[0] = bmax[0] - bmin[0];
+	d[1] = bmax[1] - bmin[1];
+	d[2] = bmax[2] - bmin[2];
+	return (d[0] * d[1] + d[1] * d[2] + d[2] * d[0]);
+}
+
+/**
+ * @brief mesh bin of 함수 - 삼각형 상자 중심이 속한 구간
+ *
+ * @param bins 분할 축, 시작, 구간 배율
+ * @param box 삼각형 상자 (최소, 최대 꼭짓점 6개 값)
+ *
+ * @return int 0 .. MESH_BINS - 1
+ */
+int	mesh_bin_of(t_mesh_bins *bins, float *box)
+{
+	int	k;
+
+	k = (int)(((box[bins->axis] + box[bins->axis + 3]) * 0.5f - bins->lo)
+			* bins->scale);
+	if (k < 0)
+		k = 0;
+	if (k >= MESH_BINS)
+		k = MESH_BINS - 1;
+	return (k);
+}
@@ -0,0 +1,167 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mesh_build.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/09 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minirt.h"
+#include "utils.h"
+#include <stdlib.h>
+
+/*
+** Box of every triangle and the identity order.
+*/
+static void	tri_boxes(t_mesh_build *b)
+{
+	float	*box;
+	int		*tri;
+	int		i;
+	int		k;
+
+	i = 0;
+	while (i < b->mesh->tri_count)
+	{
+		box = &b->boxes[i * 6];
+		tri = &b->mesh->indices[i * 3];
+		mesh_box_empty(box, box + 3);
+		k = 0;
+		while (k < 3)
+		{
+			mesh_box_grow(box, box + 3, &b->mesh->vertices[tri[k] * 3],
+				&b->mesh->vertices[tri[k] * 3]);
+			k++;
+		}
+		b->order[i] = i;
+		i++;
+	}
+}
+
+/*
+** Node box and the centroid box (b->cmin, b->cmax) of a triangle range.
+*/
+static void	node_bounds(t_mesh_build *b, t_mesh_node *node, int start,
+		int count)
+{
+	float	*box;
+	float	c[3];
+	int		i;
+
+	mesh_box_empty(node->bmin, node->bmax);
+	mesh_box_empty(b->cmin, b->cmax);
+	i = start;
+	while (i < start + count)
+	{
+		box = &b->boxes[b->order[i] * 6];
+		mesh_box_grow(node->bmin, node->bmax, box, box + 3);
+		c[0] = (box[0] + box[3]) * 0.5f;
+		c[1] = (box[1] + box[4]) * 0.5f;
+		c[2] = (box[2] + box[5]) * 0.5f;
+		mesh_box_grow(b->cmin, b->cmax, c, c);
+		i++;
+	}
+}
+
+/**
+ * @brief mesh build node 함수 - 메시 BVH 노드 재귀 생성
+ *
+ * 노드는 깊이 우선 순서로 놓인다. 왼쪽 자식은 바로 다음 노드이고
+ * 오른쪽 자식의 인덱스만 start에 저장한다.
+ *
+ * @param b 빌드 상태
+ * @param node 채울 노드 인덱스
+ * @param start order 배열의 시작
+ * @param count 삼각형 수
+ */
+void	mesh_build_node(t_mesh_build *b, int node, int start, int count)
+{
+	int	left;
+	int	right;
+
+	node_bounds(b, &b->mesh->nodes[node], start, count);
+	b->mesh->nodes[node].start = start;
+	b->mesh->nodes[node].count = count;
+	if (count <= MESH_LEAF_TRIS)
+		return ;
+	left = mesh_split(b, start, count);
+	b->mesh->nodes[node].count = 0;
+	b->depth++;
+	b->nodes_used++;
+	mesh_build_node(b, node + 1, start, left);
+	right = b->nodes_used++;
+	b->mesh->nodes[node].start = right;
+	mesh_build_node(b, right, start + left, count - left);
+	b->depth--;
+}
+
+/*
+** Reorder the index buffer along the leaves and trim the node array.
+*/
+static int	finish_build(t_mesh_build *b)
+{
+	t_mesh		*mesh;
+	int			*sorted;
+	t_mesh_node	*nodes;
+	int			i;
+
+	mesh = b->mesh;
+	sorted = malloc(sizeof(int) * 3 * mesh->tri_count);
+	if (!sorted)
+		return (0);
+	i = 0;
+	while (i < mesh->tri_count)
+	{
+		ft_memcpy(&sorted[i * 3], &mesh->indices[b->order[i] * 3],
+			sizeof(int) * 3);
+		i++;
+	}
+	free(mesh->indices);
+	mesh->indices = sorted;
+	nodes = malloc(sizeof(t_mesh_node) * mesh->node_count);
+	if (!nodes)
+		return (1);
+	ft_memcpy(nodes, mesh->nodes, sizeof(t_mesh_node) * mesh->node_count);
+	free(mesh->nodes);
+	mesh->nodes = nodes;
+	return (1);
+}
+
+/**
+ * @brief mesh build bvh 함수 - 메시 BVH 생성
+ *
+ * 삼각형 상자 중심으로 binned SAH 분할을 하고, 잎마다 삼각형이
+ * 연속하도록 인덱스 버퍼를 다시 배열한다.
+ *
+ * @param mesh 파라미터
+ *
+ * @return int 성공 1, 메모리 부족 0
+ */
+int	mesh_build_bvh(t_mesh *mesh)
+{
+	t_mesh_build	b;
+	int				ok;
+
+	b.mesh = mesh;
+	b.boxes = malloc(sizeof(float) * 6 * mesh->tri_count);
+	b.order = malloc(sizeof(int) * mesh->tri_count);
+	mesh->nodes = malloc(sizeof(t_mesh_node) * 2 * mesh->tri_count);
+	ok = (b.boxes && b.order && mesh->nodes);
+	if (ok)
+	{
+		tri_boxes(&b);
+		b.nodes_used = 1;
+		b.depth = 0;
+		mesh_build_node(&b, 0, 0, mesh->tri_count);
+		mesh->node_count = b.nodes_used;
+		ok = finish_build(&b);
+	}
+	free(b.boxes);
+	free(b.order);
+	return (ok);
+}
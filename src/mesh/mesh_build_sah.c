@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mesh_build_sah.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/09 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "mesh.h"
+#include <math.h>
+
+/*
+** Count the triangles of the range per bin and grow the bin boxes.
+*/
+static void	bin_fill(t_mesh_build *b, t_mesh_bins *bins, int start,
+		int count)
+{
+	float	*box;
+	int		k;
+	int		i;
+
+	k = 0;
+	while (k < MESH_BINS)
+	{
+		bins->count[k] = 0;
+		mesh_box_empty(bins->bmin[k], bins->bmax[k]);
+		k++;
+	}
+	i = start;
+	while (i < start + count)
+	{
+		box = &b->boxes[b->order[i] * 6];
+		k = mesh_bin_of(bins, box);
+		bins->count[k]++;
+		mesh_box_grow(bins->bmin[k], bins->bmax[k], box, box + 3);
+		i++;
+	}
+}
+
+/*
+** Left sweep: cost[i] = area(L) * n(L) of the plane before bin i.
+*/
+static void	sweep_left(t_mesh_bins *bins, float *cost)
+{
+	float	box[6];
+	int		n;
+	int		i;
+
+	mesh_box_empty(box, box + 3);
+	n = 0;
+	i = 0;
+	while (i < MESH_BINS - 1)
+	{
+		mesh_box_grow(box, box + 3, bins->bmin[i], bins->bmax[i]);
+		n += bins->count[i];
+		i++;
+		cost[i] = mesh_box_area(box, box + 3) * n;
+	}
+}
+
+/*
+** SAH cost area(L) * n(L) + area(R) * n(R) of the plane before every bin;
+** bins->split = cheapest plane.
+*/
+static void	best_plane(t_mesh_bins *bins)
+{
+	float	box[6];
+	float	cost[MESH_BINS];
+	int		n;
+	int		i;
+
+	sweep_left(bins, cost);
+	mesh_box_empty(box, box + 3);
+	n = 0;
+	cost[0] = INFINITY;
+	bins->split = 0;
+	i = MESH_BINS - 1;
+	while (i > 0)
+	{
+		mesh_box_grow(box, box + 3, bins->bmin[i], bins->bmax[i]);
+		n += bins->count[i];
+		cost[i] += mesh_box_area(box, box + 3) * n;
+		if (cost[i] < cost[bins->split])
+			bins->split = i;
+		i--;
+	}
+}
+
+/*
+** Move the triangles left of the plane to the front; returns their count.
+*/
+static int	partition(t_mesh_build *b, t_mesh_bins *bins, int start,
+		int count)
+{
+	int	i;
+	int	j;
+	int	tmp;
+
+	i = start;
+	j = start + count - 1;
+	while (i <= j)
+	{
+		if (mesh_bin_of(bins, &b->boxes[b->order[i] * 6]) < bins->split)
+			i++;
+		else
+		{
+			tmp = b->order[i];
+			b->order[i] = b->order[j];
+			b->order[j] = tmp;
+			j--;
+		}
+	}
+	return (i - start);
+}
+
+/**
+ * @brief mesh split 함수 - 삼각형 범위 분할
+ *
+ * 중심 상자가 가장 긴 축에서 MESH_BINS개 구간의 SAH 비용이 가장 낮은
+ * 평면으로 나눈다. 중심이 모두 같거나, 한쪽이 비거나, 깊이가
+ * MESH_SAH_DEPTH 이상이면 개수로 반씩 나눠 깊이를 제한한다.
+ *
+ * @param b 빌드 상태 (cmin, cmax: 범위의 중심 상자)
+ * @param start order 배열의 시작
+ * @param count 삼각형 수
+ *
+ * @return int 왼쪽 삼각형 수
+ */
+int	mesh_split(t_mesh_build *b, int start, int count)
+{
+	t_mesh_bins	bins;
+	int			left;
+	int			a;
+
+	bins.axis = 0;
+	a = 1;
+	while (a < 3)
+	{
+		if (b->cmax[a] - b->cmin[a] > b->cmax[bins.axis] - b->cmin[bins.axis])
+			bins.axis = a;
+		a++;
+	}
+	bins.scale = b->cmax[bins.axis] - b->cmin[bins.axis];
+	if (!(bins.scale > 1e-12f) || b->depth >= MESH_SAH_DEPTH)
+		return (count / 2);
+	bins.lo = b->cmin[bins.axis];
+	bins.scale = MESH_BINS / bins.scale;
+	bin_fill(b, &bins, start, count);
+	best_plane(&bins);
+	if (bins.split == 0)
+		return (count / 2);
+	left = partition(b, &bins, start, count);
+	if (left == 0 || left == count)
+		return (count / 2);
+	return (left);
+}
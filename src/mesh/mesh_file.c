@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mesh_file.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/09 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minirt.h"
+#include "utils.h"
+#include <stdlib.h>
+
+/**
+ * @brief mesh reserve 함수 - 버퍼를 need개 이상으로 확장
+ *
+ * 용량은 두 배씩 늘려 로딩 비용이 요소 수에 선형이 되게 한다.
+ *
+ * @param array 버퍼 포인터의 주소
+ * @param capacity 현재 용량 (요소 수)
+ * @param need 필요한 요소 수
+ * @param size 요소 크기 (바이트)
+ *
+ * @return int 성공 1, 메모리 부족 0
+ */
+int	mesh_reserve(void **array, int *capacity, int need, int size)
+{
+	void	*grown;
+	int		cap;
+
+	if (need <= *capacity)
+		return (1);
+	cap = *capacity * 2;
+	if (cap < 16)
+		cap = 16;
+	if (cap < need)
+		cap = need;
+	grown = malloc((size_t)cap * size);
+	if (!grown)
+		return (0);
+	if (*array)
+		ft_memcpy(grown, *array, (size_t)*capacity * size);
+	free(*array);
+	*array = grown;
+	*capacity = cap;
+	return (1);
+}
+
+/*
+** Read the whole file into one '\0'-terminated buffer (NULL on error).
+*/
+static char	*read_file(int fd)
+{
+	char	*buf;
+	int		cap;
+	int		len;
+	int		got;
+
+	buf = NULL;
+	cap = 0;
+	len = 0;
+	got = 1;
+	while (got > 0 && mesh_reserve((void **)&buf, &cap, len + 65537, 1))
+	{
+		got = read(fd, buf + len, cap - len - 1);
+		if (got > 0)
+			len += got;
+	}
+	if (got != 0)
+	{
+		free(buf);
+		return (NULL);
+	}
+	buf[len] = '\0';
+	return (buf);
+}
+
+/**
+ * @brief mesh load 함수 - OBJ 파일을 읽어 메시와 BVH 생성
+ *
+ * @param path OBJ 파일 경로 (작업 디렉터리 기준)
+ * @param mesh 출력 메시 (0으로 초기화된 상태)
+ *
+ * @return int 성공 1, 오류 0 (오류 메시지 출력)
+ */
+int	mesh_load(const char *path, t_mesh *mesh)
+{
+	char	*buf;
+	int		fd;
+	int		ok;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (print_error("Cannot open mesh file"));
+	buf = read_file(fd);
+	close(fd);
+	if (!buf)
+		return (print_error("Cannot read mesh file"));
+	ok = mesh_parse_obj(buf, mesh);
+	free(buf);
+	if (ok && mesh->tri_count == 0)
+		return (print_error("Mesh has no triangles"));
+	if (ok && !mesh_build_bvh(mesh))
+		return (print_error("Cannot allocate mesh BVH"));
+	return (ok);
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mesh_obj.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/09 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minirt.h"
+#include <stdlib.h>
+
+/*
+** Skip blanks; returns 1 if a token follows on this line.
+*/
+static int	skip_blanks(char **p)
+{
+	while (**p == ' ' || **p == '\t')
+		(*p)++;
+	return (**p != '\0' && **p != '\n' && **p != '\r' && **p != '#');
+}
+
+/*
+** v <x> <y> <z> [w]
+*/
+static int	parse_vertex(char *p, t_mesh *mesh)
+{
+	float	*v;
+	char	*end;
+	int		i;
+
+	if (!mesh_reserve((void **)&mesh->vertices, &mesh->vertex_capacity,
+			mesh->vertex_count * 3 + 3, sizeof(float)))
+		return (print_error("Cannot allocate mesh vertices"));
+	v = &mesh->vertices[mesh->vertex_count * 3];
+	i = 0;
+	while (i < 3)
+	{
+		if (!skip_blanks(&p))
+			return (print_error("Invalid mesh vertex"));
+		v[i] = strtof(p, &end);
+		if (end == p)
+			return (print_error("Invalid mesh vertex"));
+		p = end;
+		i++;
+	}
+	mesh->vertex_count++;
+	return (1);
+}
+
+/**
+ * @brief mesh parse obj 함수 - OBJ 텍스트 파싱
+ *
+ * v와 f 줄만 읽고 법선, 텍스처 좌표, 그룹, 재질 줄은 무시한다.
+ *
+ * @param buf 파일 전체 ('\0'으로 끝남)
+ * @param mesh 출력 메시
+ *
+ * @return int 성공 1, 오류 0
+ */
+int	mesh_parse_obj(char *buf, t_mesh *mesh)
+{
+	int	ok;
+
+	ok = 1;
+	while (ok && *buf)
+	{
+		while (*buf == ' ' || *buf == '\t')
+			buf++;
+		if (buf[0] == 'v' && (buf[1] == ' ' || buf[1] == '\t'))
+			ok = parse_vertex(buf + 2, mesh);
+		else if (buf[0] == 'f' && (buf[1] == ' ' || buf[1] == '\t'))
+			ok = mesh_parse_face(buf + 2, mesh);
+		while (*buf && *buf != '\n')
+			buf++;
+		if (*buf == '\n')
+			buf++;
+	}
+	return (ok);
+}
@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mesh_obj_face.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/09 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minirt.h"
+#include "utils.h"
+#include <stdlib.h>
+
+/*
+** Skip blanks; returns 1 if a token follows on this line.
+*/
+static int	skip_blanks(char **p)
+{
+	while (**p == ' ' || **p == '\t')
+		(*p)++;
+	return (**p != '\0' && **p != '\n' && **p != '\r' && **p != '#');
+}
+
+/*
+** One face vertex (i, i/t, i//n or i/t/n); negative indices count back
+** from the last vertex. Returns 1, 0 at the end of the line, -1 if bad.
+*/
+static int	face_index(char **p, int vertex_count, int *out)
+{
+	char	*end;
+	long	v;
+
+	if (!skip_blanks(p))
+		return (0);
+	v = strtol(*p, &end, 10);
+	if (end == *p)
+		return (-1);
+	if (v < 0)
+		v += vertex_count + 1;
+	if (v < 1 || v > vertex_count)
+		return (-1);
+	*out = (int)v - 1;
+	while (*end && *end != ' ' && *end != '\t' && *end != '\n'
+		&& *end != '\r')
+		end++;
+	*p = end;
+	return (1);
+}
+
+/*
+** Append triangle v; the next fan triangle starts from (v[0], v[2]).
+*/
+static int	push_triangle(t_mesh *mesh, int *v)
+{
+	if (!mesh_reserve((void **)&mesh->indices, &mesh->tri_capacity,
+			mesh->tri_count * 3 + 3, sizeof(int)))
+		return (print_error("Cannot allocate mesh triangles"));
+	ft_memcpy(&mesh->indices[mesh->tri_count * 3], v, sizeof(int) * 3);
+	mesh->tri_count++;
+	v[1] = v[2];
+	return (1);
+}
+
+/**
+ * @brief mesh parse face 함수 - OBJ f 줄 파싱
+ *
+ * 다각형은 (a, b, c), (a, c, d), ... 부채꼴 삼각형으로 나눈다.
+ *
+ * @param p "f " 다음 위치
+ * @param mesh 출력 메시
+ *
+ * @return int 성공 1, 오류 0
+ */
+int	mesh_parse_face(char *p, t_mesh *mesh)
+{
+	int	v[3];
+	int	got;
+	int	n;
+
+	n = 0;
+	got = face_index(&p, mesh->vertex_count, &v[0]);
+	while (got == 1)
+	{
+		n++;
+		if (n >= 3 && !push_triangle(mesh, v))
+			return (0);
+		got = face_index(&p, mesh->vertex_count, &v[1 + (n >= 2)]);
+	}
+	if (got < 0 || n < 3)
+		return (print_error("Invalid mesh face"));
+	return (1);
+}
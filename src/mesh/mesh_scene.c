@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mesh_scene.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/09 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minirt.h"
+#include "window.h"
+#include <stdlib.h>
+
+/**
+ * @brief mesh place 함수 - 메시의 월드 경계 계산
+ *
+ * BVH 루트 상자를 scale과 position으로 옮겨 경계 상자와 경계 구를
+ * 만든다 (장면 BVH와 그림자 묶음 컬링에서 사용).
+ *
+ * @param mesh 파라미터
+ */
+void	mesh_place(t_mesh *mesh)
+{
+	t_mesh_node	*root;
+
+	root = &mesh->nodes[0];
+	mesh->bounds.min = vec3_add(mesh->position, vec3_multiply((t_vec3){
+				root->bmin[0], root->bmin[1], root->bmin[2]}, mesh->scale));
+	mesh->bounds.max = vec3_add(mesh->position, vec3_multiply((t_vec3){
+				root->bmax[0], root->bmax[1], root->bmax[2]}, mesh->scale));
+	mesh->center = vec3_multiply(vec3_add(mesh->bounds.min,
+				mesh->bounds.max), 0.5);
+	mesh->radius = vec3_magnitude(vec3_subtract(mesh->bounds.max,
+				mesh->bounds.min)) / 2;
+}
+
+/**
+ * @brief intersect mesh 함수 - 메시 교차 검사
+ *
+ * 광선을 메시 좌표로 옮겨 메시 BVH를 탐색한다. 다른 교차 함수처럼
+ * hit->distance보다 가까울 때만 hit를 갱신하고, 면 법선은 광선 쪽을
+ * 향하게 뒤집는다 (평면과 같다).
+ *
+ * @param scene 파라미터
+ * @param index 메시 인덱스
+ * @param ray 월드 광선
+ * @param hit 파라미터
+ *
+ * @return int 더 가까운 교차가 있으면 1
+ */
+int	intersect_mesh(t_scene *scene, int index, t_ray *ray, t_hit *hit)
+{
+	t_mesh		*mesh;
+	t_mesh_ray	mray;
+	int			tri;
+
+	mesh = &scene->meshes[index];
+	mesh_ray_init(mesh, ray, hit->distance, &mray);
+	tri = mesh_traverse(mesh, &mray, 0);
+	if (tri < 0)
+		return (0);
+	hit->distance = mray.tmax * mesh->scale;
+	hit->point = vec3_add(ray->origin,
+			vec3_multiply(ray->direction, hit->distance));
+	hit->normal = mesh_triangle_normal(mesh, tri);
+	if (vec3_dot(hit->normal, ray->direction) > 0)
+		hit->normal = vec3_multiply(hit->normal, -1.0);
+	hit->color = mesh->color;
+	return (1);
+}
+
+/**
+ * @brief check mesh intersections 함수 - 모든 메시 검사
+ *
+ * BVH를 쓰지 않을 때 trace_ray가 사용한다.
+ *
+ * @param scene 파라미터
+ * @param ray 파라미터
+ * @param hit 파라미터
+ *
+ * @return int 반환값
+ */
+int	check_mesh_intersections(t_scene *scene, t_ray *ray, t_hit *hit)
+{
+	int	i;
+	int	hit_found;
+
+	hit_found = 0;
+	i = 0;
+	while (i < scene->mesh_count)
+	{
+		if (intersect_mesh(scene, i, ray, hit))
+		{
+			hit->obj_type = OBJ_MESH;
+			hit->obj_index = i;
+			hit_found = 1;
+		}
+		i++;
+	}
+	return (hit_found);
+}
+
+/**
+ * @brief meshes free 함수 - 메시 버퍼 해제
+ *
+ * @param scene 파라미터
+ */
+void	meshes_free(t_scene *scene)
+{
+	int	i;
+
+	i = 0;
+	while (i < scene->mesh_count)
+	{
+		free(scene->meshes[i].vertices);
+		free(scene->meshes[i].indices);
+		free(scene->meshes[i].nodes);
+		i++;
+	}
+	free(scene->meshes);
+	scene->meshes = NULL;
+	scene->mesh_count = 0;
+	scene->mesh_capacity = 0;
+}
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mesh_traverse.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/09 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minirt.h"
+#include <math.h>
+
+/**
+ * @brief mesh ray init 함수 - 월드 광선을 메시 좌표 광선으로 변환
+ *
+ * 방향은 그대로 단위 벡터이므로 메시 좌표 거리 = 월드 거리 / scale.
+ * 최소 거리는 HIT_EPSILON에 맞춘다.
+ *
+ * @param mesh 파라미터
+ * @param ray 월드 광선
+ * @param tmax 월드 최대 거리 (현재 가장 가까운 교차)
+ * @param out 출력 메시 광선
+ */
+void	mesh_ray_init(t_mesh *mesh, t_ray *ray, t_real tmax, t_mesh_ray *out)
+{
+	t_vec3	o;
+
+	o = vec3_multiply(vec3_subtract(ray->origin, mesh->position),
+			1 / mesh->scale);
+	out->org[0] = o.x;
+	out->org[1] = o.y;
+	out->org[2] = o.z;
+	out->dir[0] = ray->direction.x;
+	out->dir[1] = ray->direction.y;
+	out->dir[2] = ray->direction.z;
+	out->inv[0] = 1.0f / out->dir[0];
+	out->inv[1] = 1.0f / out->dir[1];
+	out->inv[2] = 1.0f / out->dir[2];
+	out->tmin = HIT_EPSILON / mesh->scale;
+	out->tmax = tmax / mesh->scale;
+}
+
+/*
+** One slab: narrow [near, far] to [lo, hi]. Plain comparisons (no fminf /
+** fmaxf) skip the NaN of a zero direction on a slab plane, like
+** bvh_wide_slab.
+*/
+static void	slab_axis(float lo, float hi, float *near, float *far)
+{
+	float	swap;
+
+	if (lo > hi)
+	{
+		swap = lo;
+		lo = hi;
+		hi = swap;
+	}
+	if (lo > *near)
+		*near = lo;
+	if (hi < *far)
+		*far = hi;
+}
+
+/*
+** Slab test: entry distance of the node box, INFINITY if the ray misses
+** it inside [tmin, tmax].
+*/
+static float	node_entry(t_mesh_node *node, t_mesh_ray *r)
+{
+	float	lo;
+	float	hi;
+	int		a;
+
+	lo = r->tmin;
+	hi = r->tmax;
+	a = 0;
+	while (a < 3)
+	{
+		slab_axis((node->bmin[a] - r->org[a]) * r->inv[a],
+			(node->bmax[a] - r->org[a]) * r->inv[a], &lo, &hi);
+		a++;
+	}
+	if (lo > hi)
+		return (INFINITY);
+	return (lo);
+}
+
+/*
+** Push the children the ray enters, the nearer one last (popped first).
+*/
+static void	push_children(t_mesh *mesh, int node, t_mesh_ray *r,
+		t_mesh_stack *st)
+{
+	int		child[2];
+	float	t[2];
+	int		k;
+
+	child[0] = node + 1;
+	child[1] = mesh->nodes[node].start;
+	t[0] = node_entry(&mesh->nodes[child[0]], r);
+	t[1] = node_entry(&mesh->nodes[child[1]], r);
+	k = (t[0] < t[1]);
+	if (t[k] < INFINITY && st->n < MESH_STACK)
+	{
+		st->node[st->n] = child[k];
+		st->tnear[st->n] = t[k];
+		st->n++;
+	}
+	if (t[1 - k] < INFINITY && st->n < MESH_STACK)
+	{
+		st->node[st->n] = child[1 - k];
+		st->tnear[st->n] = t[1 - k];
+		st->n++;
+	}
+}
+
+/**
+ * @brief mesh traverse 함수 - 메시 BVH 탐색
+ *
+ * 가까운 자식부터 방문하고, 꺼낸 노드의 진입 거리가 지금까지의
+ * 교차보다 멀면 건너뛴다.
+ *
+ * @param mesh 파라미터
+ * @param mray 메시 광선 (교차하면 tmax가 그 거리로 줄어든다)
+ * @param any_hit 1이면 첫 교차에서 멈춘다 (그림자)
+ *
+ * @return int 삼각형 인덱스, 없으면 -1
+ */
+int	mesh_traverse(t_mesh *mesh, t_mesh_ray *mray, int any_hit)
+{
+	t_mesh_stack	st;
+	int				hit;
+	int				tri;
+	int				node;
+
+	hit = -1;
+	st.n = 1;
+	st.node[0] = 0;
+	st.tnear[0] = node_entry(&mesh->nodes[0], mray);
+	while (st.n > 0 && !(any_hit && hit >= 0))
+	{
+		st.n--;
+		node = st.node[st.n];
+		if (st.tnear[st.n] > mray->tmax)
+			node = -1;
+		else if (mesh->nodes[node].count == 0)
+			push_children(mesh, node, mray, &st);
+		tri = -1;
+		if (node >= 0 && mesh->nodes[node].count > 0)
+			tri = mesh_leaf_intersect(mesh, &mesh->nodes[node], mray);
+		if (tri >= 0)
+			hit = tri;
+	}
+	return (hit);
+}
@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mesh_triangle.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/09 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minirt.h"
+#include <math.h>
+
+/*
+** Leaf triangles into SoA lanes; a short leaf repeats its last triangle.
+*/
+static void	gather(t_mesh *mesh, t_mesh_node *leaf, t_mesh_tri4 *q)
+{
+	float	*v[3];
+	int		*tri;
+	int		k;
+	int		a;
+
+	k = 0;
+	while (k < 4)
+	{
+		tri = mesh->indices + 3 * (leaf->start + leaf->count - 1);
+		if (k < leaf->count)
+			tri = mesh->indices + 3 * (leaf->start + k);
+		v[0] = mesh->vertices + 3 * tri[0];
+		v[1] = mesh->vertices + 3 * tri[1];
+		v[2] = mesh->vertices + 3 * tri[2];
+		a = 0;
+		while (a < 3)
+		{
+			q->v0[a][k] = v[0][a];
+			q->e1[a][k] = v[1][a] - v[0][a];
+			q->e2[a][k] = v[2][a] - v[0][a];
+			a++;
+		}
+		k++;
+	}
+}
+
+#if !VEC3_USE_SSE2
+
+/*
+** One lane: p = d x e2, s = o - v0, x = s x e1, u = s . p / det,
+** v = d . x / det, t = e2 . x / det.
+*/
+static float	mt1(t_mesh_tri4 *q, t_mesh_ray *r, int i)
+{
+	float	p[3];
+	float	s[3];
+	float	x[3];
+	float	k[3];
+
+	p[0] = r->dir[1] * q->e2[2][i] - r->dir[2] * q->e2[1][i];
+	p[1] = r->dir[2] * q->e2[0][i] - r->dir[0] * q->e2[2][i];
+	p[2] = r->dir[0] * q->e2[1][i] - r->dir[1] * q->e2[0][i];
+	k[0] = q->e1[0][i] * p[0] + q->e1[1][i] * p[1] + q->e1[2][i] * p[2];
+	if (fabsf(k[0]) <= MESH_DET_EPSILON)
+		return (INFINITY);
+	k[0] = 1.0f / k[0];
+	s[0] = r->org[0] - q->v0[0][i];
+	s[1] = r->org[1] - q->v0[1][i];
+	s[2] = r->org[2] - q->v0[2][i];
+	k[1] = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * k[0];
+	x[0] = s[1] * q->e1[2][i] - s[2] * q->e1[1][i];
+	x[1] = s[2] * q->e1[0][i] - s[0] * q->e1[2][i];
+	x[2] = s[0] * q->e1[1][i] - s[1] * q->e1[0][i];
+	k[2] = (r->dir[0] * x[0] + r->dir[1] * x[1] + r->dir[2] * x[2]) * k[0];
+	if (k[1] < 0.0f || k[2] < 0.0f || k[1] + k[2] > 1.0f)
+		return (INFINITY);
+	return ((q->e2[0][i] * x[0] + q->e2[1][i] * x[1]
+			+ q->e2[2][i] * x[2]) * k[0]);
+}
+
+/**
+ * @brief mesh mt4 함수 - 삼각형 4개 Moller-Trumbore (스칼라)
+ *
+ * @param q 삼각형 4개 (SoA)
+ * @param r 메시 광선
+ * @param t 출력 거리 4개 (놓치면 INFINITY)
+ */
+void	mesh_mt4(t_mesh_tri4 *q, t_mesh_ray *r, float *t)
+{
+	int	i;
+
+	i = 0;
+	while (i < 4)
+	{
+		t[i] = mt1(q, r, i);
+		i++;
+	}
+}
+
+#endif
+
+/**
+ * @brief mesh leaf intersect 함수 - 리프 삼각형 교차
+ *
+ * @param mesh 파라미터
+ * @param leaf 리프 노드
+ * @param mray 메시 광선 (교차하면 tmax가 그 거리로 줄어든다)
+ *
+ * @return int 가장 가까운 삼각형 인덱스, 없으면 -1
+ */
+int	mesh_leaf_intersect(t_mesh *mesh, t_mesh_node *leaf, t_mesh_ray *mray)
+{
+	t_mesh_tri4	q;
+	float		t[4];
+	int			hit;
+	int			k;
+
+	gather(mesh, leaf, &q);
+	mesh_mt4(&q, mray, t);
+	hit = -1;
+	k = 0;
+	while (k < leaf->count)
+	{
+		if (t[k] > mray->tmin && t[k] < mray->tmax)
+		{
+			mray->tmax = t[k];
+			hit = leaf->start + k;
+		}
+		k++;
+	}
+	return (hit);
+}
+
+/**
+ * @brief mesh triangle normal 함수 - 삼각형 면 법선
+ *
+ * @param mesh 파라미터
+ * @param tri 삼각형 인덱스
+ *
+ * @return t_vec3 단위 법선 (메시 좌표, 균일 스케일이라 월드와 같다)
+ */
+t_vec3	mesh_triangle_normal(t_mesh *mesh, int tri)
+{
+	float	*v[3];
+	t_vec3	e1;
+	t_vec3	e2;
+
+	v[0] = mesh->vertices + 3 * mesh->indices[3 * tri];
+	v[1] = mesh->vertices + 3 * mesh->indices[3 * tri + 1];
+	v[2] = mesh->vertices + 3 * mesh->indices[3 * tri + 2];
+	e1 = (t_vec3){v[1][0] - v[0][0], v[1][1] - v[0][1], v[1][2] - v[0][2]};
+	e2 = (t_vec3){v[2][0] - v[0][0], v[2][1] - v[0][1], v[2][2] - v[0][2]};
+	return (vec3_normalize(vec3_cross(e1, e2)));
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mesh_triangle_sse.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/09 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "mesh.h"
+#include <math.h>
+
+/*
+** Four triangles per call in SSE registers (make SIMD=1); the scalar
+** lanes are in mesh_triangle.c.
+*/
+#if VEC3_USE_SSE2
+
+static __m128	dot3(__m128 *a, __m128 *b)
+{
+	return (_mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0], b[0]),
+				_mm_mul_ps(a[1], b[1])), _mm_mul_ps(a[2], b[2])));
+}
+
+static void	cross3(__m128 *a, __m128 *b, __m128 *out)
+{
+	out[0] = _mm_sub_ps(_mm_mul_ps(a[1], b[2]), _mm_mul_ps(a[2], b[1]));
+	out[1] = _mm_sub_ps(_mm_mul_ps(a[2], b[0]), _mm_mul_ps(a[0], b[2]));
+	out[2] = _mm_sub_ps(_mm_mul_ps(a[0], b[1]), _mm_mul_ps(a[1], b[0]));
+}
+
+/*
+** p = d x e2, det = e1 . p, s = o - v0: k[0] = 1 / det, k[1] = u.
+** Returns the lanes with a usable determinant and u >= 0.
+*/
+static __m128	mt4_u(t_mesh_tri4 *q, t_mesh_ray *r, __m128 *s, __m128 *k)
+{
+	__m128	d[3];
+	__m128	e[3];
+	__m128	p[3];
+	int		a;
+
+	a = 0;
+	while (a < 3)
+	{
+		d[a] = _mm_set1_ps(r->dir[a]);
+		e[a] = _mm_loadu_ps(q->e2[a]);
+		s[a] = _mm_sub_ps(_mm_set1_ps(r->org[a]), _mm_loadu_ps(q->v0[a]));
+		a++;
+	}
+	cross3(d, e, p);
+	e[0] = _mm_loadu_ps(q->e1[0]);
+	e[1] = _mm_loadu_ps(q->e1[1]);
+	e[2] = _mm_loadu_ps(q->e1[2]);
+	k[0] = dot3(e, p);
+	k[3] = _mm_cmpgt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), k[0]),
+			_mm_set1_ps(MESH_DET_EPSILON));
+	k[0] = _mm_div_ps(_mm_set1_ps(1.0f), k[0]);
+	k[1] = _mm_mul_ps(dot3(s, p), k[0]);
+	return (_mm_and_ps(k[3], _mm_cmpge_ps(k[1], _mm_setzero_ps())));
+}
+
+/**
+ * @brief mesh mt4 함수 - 삼각형 4개 Moller-Trumbore (SSE)
+ *
+ * @param q 삼각형 4개 (SoA)
+ * @param r 메시 광선
+ * @param t 출력 거리 4개 (놓치면 INFINITY)
+ */
+void	mesh_mt4(t_mesh_tri4 *q, t_mesh_ray *r, float *t)
+{
+	__m128	s[3];
+	__m128	k[4];
+	__m128	e[3];
+	__m128	x[3];
+
+	k[3] = mt4_u(q, r, s, k);
+	e[0] = _mm_loadu_ps(q->e1[0]);
+	e[1] = _mm_loadu_ps(q->e1[1]);
+	e[2] = _mm_loadu_ps(q->e1[2]);
+	cross3(s, e, x);
+	e[0] = _mm_set1_ps(r->dir[0]);
+	e[1] = _mm_set1_ps(r->dir[1]);
+	e[2] = _mm_set1_ps(r->dir[2]);
+	k[2] = _mm_mul_ps(dot3(e, x), k[0]);
+	e[0] = _mm_loadu_ps(q->e2[0]);
+	e[1] = _mm_loadu_ps(q->e2[1]);
+	e[2] = _mm_loadu_ps(q->e2[2]);
+	s[0] = _mm_mul_ps(dot3(e, x), k[0]);
+	k[3] = _mm_and_ps(k[3], _mm_and_ps(_mm_cmpge_ps(k[2], _mm_setzero_ps()),
+				_mm_cmple_ps(_mm_add_ps(k[1], k[2]), _mm_set1_ps(1.0f))));
+	_mm_storeu_ps(t, _mm_or_ps(_mm_and_ps(k[3], s[0]),
+			_mm_andnot_ps(k[3], _mm_set1_ps(INFINITY))));
+}
+
+#endif
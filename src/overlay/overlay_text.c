@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   overlay_text.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/24 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/24 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "overlay.h"
+
+/*
+** Copy one glyph into the layer; pen holds layer-local top-left
+** coordinates and the opaque ARGB color.
+*/
+static void	blit_glyph(t_overlay *layer, t_text_pen *pen,
+		const unsigned char *rows)
+{
+	int	row;
+	int	col;
+	int	px;
+	int	py;
+
+	row = 0;
+	while (row < FONT_HEIGHT)
+	{
+		py = pen->y + row;
+		col = 0;
+		while (py >= 0 && py < layer->height && col < FONT_WIDTH)
+		{
+			px = pen->x + col;
+			if (px >= 0 && px < layer->width && ((rows[row] >> col) & 1))
+				layer->pixels[py * layer->width + px]
+					= (unsigned int)pen->color;
+			col++;
+		}
+		row++;
+	}
+}
+
+/**
+ * @brief overlay text 함수 - 레이어에 문자열 그리기
+ *
+ * @param layer 파라미터
+ * @param pen 윈도우 좌표 기준선 위치와 색상
+ * @param str 파라미터
+ */
+void	overlay_text(t_overlay *layer, t_text_pen pen, const char *str)
+{
+	const unsigned char	*rows;
+
+	pen.x -= layer->x;
+	pen.y -= layer->y + FONT_ASCENT;
+	pen.color = (int)(0xFF000000u | (unsigned int)pen.color);
+	while (*str && pen.x < layer->width)
+	{
+		rows = font_glyph(*str);
+		if (rows)
+			blit_glyph(layer, &pen, rows);
+		pen.x += FONT_WIDTH;
+		str++;
+	}
+	layer->dirty = 1;
+}
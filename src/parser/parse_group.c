@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_group.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/08 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/08 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "parser.h"
+#include "window.h"
+#include "utils.h"
+
+/**
+ * @brief group find 함수 - 이름으로 그룹 찾기
+ *
+ * @param scene 파라미터
+ * @param name 그룹 이름 (공백 또는 문자열 끝에서 끝난다)
+ *
+ * @return int 그룹 인덱스, 없으면 -1
+ */
+int	group_find(t_scene *scene, char *name)
+{
+	char	*own;
+	int		i;
+	int		k;
+
+	i = 0;
+	while (i < scene->group_count)
+	{
+		own = scene->groups[i].name;
+		k = 0;
+		while (name[k] && name[k] != ' ' && name[k] == own[k])
+			k++;
+		if ((name[k] == '\0' || name[k] == ' ') && own[k] == '\0')
+			return (i);
+		i++;
+	}
+	return (-1);
+}
+
+/*
+** Open a group definition: gr <name>
+** Its members are claimed from the end of the object arrays.
+*/
+static int	parse_group_begin(char *line, t_scene *scene)
+{
+	t_group	*group;
+	int		len;
+
+	if (scene->in_group)
+		return (print_error("Groups cannot be nested"));
+	if (scene->group_count >= GROUP_MAX)
+		return (print_error("Too many groups"));
+	line += 3;
+	while (*line == ' ')
+		line++;
+	len = 0;
+	while (line[len] && line[len] != ' ')
+		len++;
+	if (len == 0 || len >= GROUP_NAME_MAX)
+		return (print_error("Invalid group name"));
+	if (group_find(scene, line) >= 0)
+		return (print_error("Group declared multiple times"));
+	group = &scene->groups[scene->group_count];
+	ft_memset(group, 0, sizeof(t_group));
+	ft_memcpy(group->name, line, len);
+	group->first_sphere = OBJECT_SLOTS - scene->group_spheres;
+	group->first_cylinder = OBJECT_SLOTS - scene->group_cylinders;
+	scene->group_count++;
+	scene->in_group = 1;
+	return (1);
+}
+
+/*
+** Close the open group: ge
+*/
+static int	parse_group_end(t_scene *scene)
+{
+	t_group	*group;
+
+	if (!scene->in_group)
+		return (print_error("Group end (ge) without group (gr)"));
+	group = &scene->groups[scene->group_count - 1];
+	if (group->sphere_count + group->cylinder_count == 0)
+		return (print_error("Empty group"));
+	scene->in_group = 0;
+	return (1);
+}
+
+/**
+ * @brief group claim 함수 - 방금 파싱한 객체를 열린 그룹의 멤버로 이동
+ *
+ * 그룹 안이 아니면 아무것도 하지 않는다. 멤버는 배열 끝에서부터
+ * 채우므로 월드 객체 수 (sphere_count 등)에 들어가지 않는다.
+ *
+ * @param scene 파라미터
+ * @param type OBJ_SPHERE 또는 OBJ_CYLINDER
+ *
+ * @return int 항상 1
+ */
+int	group_claim(t_scene *scene, int type)
+{
+	t_group	*group;
+	int		slot;
+
+	if (!scene->in_group)
+		return (1);
+	group = &scene->groups[scene->group_count - 1];
+	if (type == OBJ_SPHERE)
+	{
+		scene->sphere_count--;
+		scene->group_spheres++;
+		slot = OBJECT_SLOTS - scene->group_spheres;
+		scene->spheres[slot] = scene->spheres[scene->sphere_count];
+		group->first_sphere = slot;
+		group->sphere_count++;
+		return (1);
+	}
+	scene->cylinder_count--;
+	scene->group_cylinders++;
+	slot = OBJECT_SLOTS - scene->group_cylinders;
+	scene->cylinders[slot] = scene->cylinders[scene->cylinder_count];
+	group->first_cylinder = slot;
+	group->cylinder_count++;
+	return (1);
+}
+
+/**
+ * @brief parse group line 함수 - 그룹과 인스턴스 요소 분기
+ *
+ * gr <name> 은 그룹 정의를 열고 ge 는 닫는다. in 은 인스턴스다.
+ *
+ * @param line 파라미터
+ * @param scene 파라미터
+ *
+ * @return int 성공 1, 오류 또는 알 수 없는 식별자이면 0
+ */
+int	parse_group_line(char *line, t_scene *scene)
+{
+	if (line[0] == 'g' && line[1] == 'r' && line[2] == ' ')
+		return (parse_group_begin(line, scene));
+	if (line[0] == 'g' && line[1] == 'e'
+		&& (line[2] == '\0' || line[2] == ' '))
+		return (parse_group_end(scene));
+	if (line[0] == 'i' && line[1] == 'n' && line[2] == ' ')
+		return (parse_instance(line, scene));
+	return (print_error("Invalid element identifier"));
+}
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_instance.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/08 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/08 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "parser.h"
+#include "utils.h"
+#include <stdlib.h>
+#include <math.h>
+
+static char	*skip_to_next_token(char *token)
+{
+	while (*token && *token != ' ')
+		token++;
+	while (*token == ' ')
+		token++;
+	return (token);
+}
+
+/*
+** Orthonormal basis with basis[1] = axis. The group +y axis maps to axis;
+** axis (0, 1, 0) gives the identity.
+*/
+static void	instance_basis(t_instance *inst, t_vec3 axis)
+{
+	t_vec3	ref;
+
+	ref = (t_vec3){0.0, 0.0, 1.0};
+	if (fabs(axis.z) > 0.999)
+		ref = (t_vec3){1.0, 0.0, 0.0};
+	inst->basis[1] = axis;
+	inst->basis[0] = vec3_normalize(vec3_cross(axis, ref));
+	inst->basis[2] = vec3_cross(inst->basis[0], axis);
+}
+
+/*
+** Make room for one more instance (the array doubles when full).
+*/
+static int	instance_reserve(t_scene *scene)
+{
+	t_instance	*grown;
+	int			capacity;
+
+	if (scene->instance_count < scene->instance_capacity)
+		return (1);
+	capacity = scene->instance_capacity * 2;
+	if (capacity == 0)
+		capacity = 16;
+	grown = malloc(sizeof(t_instance) * capacity);
+	if (!grown)
+		return (0);
+	if (scene->instances)
+		ft_memcpy(grown, scene->instances,
+			sizeof(t_instance) * scene->instance_count);
+	free(scene->instances);
+	scene->instances = grown;
+	scene->instance_capacity = capacity;
+	return (1);
+}
+
+/*
+** Parse <x,y,z> <nx,ny,nz> <scale> after the group name.
+*/
+static int	parse_transform(char *token, t_instance *inst)
+{
+	t_vec3	axis;
+
+	token = skip_to_next_token(token);
+	if (!parse_vector(token, &inst->position))
+		return (print_error("Invalid instance position"));
+	token = skip_to_next_token(token);
+	if (!parse_vector(token, &axis) || vec3_magnitude(axis) < EPSILON)
+		return (print_error("Invalid instance axis"));
+	instance_basis(inst, vec3_normalize(axis));
+	inst->scale = ft_atof(skip_to_next_token(token));
+	if (inst->scale <= 0)
+		return (print_error("Instance scale must be positive"));
+	return (1);
+}
+
+/*
+** Parse instance element from scene file.
+** Format: in <group> <x,y,z> <nx,ny,nz> <scale>
+** The group must be defined (gr ... ge) earlier in the file.
+*/
+/**
+ * @brief parse instance 함수 - 파싱 수행
+ *
+ * @param line 파라미터
+ * @param scene 파라미터
+ *
+ * @return int 반환값
+ */
+int	parse_instance(char *line, t_scene *scene)
+{
+	t_instance	*inst;
+	char		*token;
+
+	if (scene->in_group)
+		return (print_error("Instances cannot be part of a group"));
+	if (!instance_reserve(scene))
+		return (print_error("Cannot allocate instances"));
+	inst = &scene->instances[scene->instance_count];
+	token = line + 3;
+	while (*token == ' ')
+		token++;
+	inst->group = group_find(scene, token);
+	if (inst->group < 0)
+		return (print_error("Unknown group"));
+	if (!parse_transform(token, inst))
+		return (0);
+	scene->instance_count++;
+	return (1);
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_mesh.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/09 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minirt.h"
+#include "parser.h"
+#include "utils.h"
+
+static char	*skip_to_next_token(char *token)
+{
+	while (*token && *token != ' ')
+		token++;
+	while (*token == ' ')
+		token++;
+	return (token);
+}
+
+/*
+** Copy the path token into path; 0 if it is empty or too long.
+*/
+static int	copy_path(char *token, char *path)
+{
+	int	len;
+
+	len = 0;
+	while (token[len] && token[len] != ' ' && token[len] != '\n'
+		&& token[len] != '\t')
+		len++;
+	if (len == 0 || len >= MESH_PATH_MAX)
+		return (0);
+	ft_memcpy(path, token, len);
+	path[len] = '\0';
+	return (1);
+}
+
+/*
+** Parse <x,y,z> <scale> <R,G,B> after the path.
+*/
+static int	parse_placement(char *token, t_mesh *mesh)
+{
+	token = skip_to_next_token(token);
+	if (!parse_vector(token, &mesh->position))
+		return (print_error("Invalid mesh position"));
+	token = skip_to_next_token(token);
+	mesh->scale = ft_atof(token);
+	if (mesh->scale <= 0)
+		return (print_error("Mesh scale must be positive"));
+	token = skip_to_next_token(token);
+	if (!parse_color(token, &mesh->color))
+		return (print_error("Invalid mesh color"));
+	return (1);
+}
+
+/*
+** Parse mesh element from scene file.
+** Format: mh <file.obj> <x,y,z> <scale> <R,G,B>
+** The OBJ path is relative to the working directory. The mesh is
+** counted before loading so cleanup_scene frees a partial load.
+*/
+/**
+ * @brief parse mesh 함수 - 파싱 수행
+ *
+ * @param line 파라미터
+ * @param scene 파라미터
+ *
+ * @return int 반환값
+ */
+int	parse_mesh(char *line, t_scene *scene)
+{
+	t_mesh	*mesh;
+	char	path[MESH_PATH_MAX];
+	char	*token;
+
+	if (scene->in_group)
+		return (print_error("Meshes cannot be part of a group"));
+	if (!mesh_reserve((void **)&scene->meshes, &scene->mesh_capacity,
+			scene->mesh_count + 1, sizeof(t_mesh)))
+		return (print_error("Cannot allocate meshes"));
+	mesh = &scene->meshes[scene->mesh_count];
+	ft_memset(mesh, 0, sizeof(t_mesh));
+	scene->mesh_count++;
+	token = line + 3;
+	while (*token == ' ')
+		token++;
+	if (!copy_path(token, path))
+		return (print_error("Invalid mesh path"));
+	if (!parse_placement(token, mesh) || !mesh_load(path, mesh))
+		return (0);
+	mesh_place(mesh);
+	return (1);
+}
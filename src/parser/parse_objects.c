@@ -31,7 +31,8 @@ static char	*skip_to_next_token(char *token)
 /*
 ** Parse sphere object from scene file.
 ** Format: sp <x,y,z> <diameter> <R,G,B>
-** Validates diameter is positive.
+** Validates diameter is positive. Group members share the array
+** (OBJECT_SLOTS in total).
 */
 /**
  * @brief parse sphere 함수 - 파싱 수행
@@ -46,7 +47,7 @@ int	parse_sphere(char *line, t_scene *scene)
 	char		*token;
 	t_sphere	*sphere;
 
-	if (scene->sphere_count >= 100)
+	if (scene->sphere_count + scene->group_spheres >= OBJECT_SLOTS)
 		return (print_error("Too many spheres"));
 	sphere = &scene->spheres[scene->sphere_count];
 	token = line + 3;
@@ -58,7 +59,7 @@ int	parse_sphere(char *line, t_scene *scene)
 	sphere->diameter = ft_atof(token);
 	if (sphere->diameter <= 0)
 		return (print_error("Sphere diameter must be positive"));
-	sphere->radius = sphere->diameter / 2.0;
+	sphere->radius = sphere->diameter / 2;
 	sphere->radius_squared = sphere->radius * sphere->radius;
 	snprintf(sphere->id, 8, "sp-%d", scene->sphere_count + 1);
 	token = skip_to_next_token(token);
@@ -86,6 +87,8 @@ int	parse_plane(char *line, t_scene *scene)
 	char		*token;
 	t_plane		*plane;
 
+	if (scene->in_group)
+		return (print_error("Planes cannot be part of a group"));
 	if (scene->plane_count >= 100)
 		return (print_error("Too many planes"));
 	plane = &scene->planes[scene->plane_count];
@@ -127,9 +130,9 @@ static int	parse_cylinder_params(char *token, t_cylinder *cylinder)
 	cylinder->height = ft_atof(token);
 	if (cylinder->diameter <= 0 || cylinder->height <= 0)
 		return (print_error("Cylinder dimensions must be positive"));
-	cylinder->radius = cylinder->diameter / 2.0;
+	cylinder->radius = cylinder->diameter / 2;
 	cylinder->radius_squared = cylinder->radius * cylinder->radius;
-	cylinder->half_height = cylinder->height / 2.0;
+	cylinder->half_height = cylinder->height / 2;
 	return (1);
 }
 
@@ -151,7 +154,7 @@ int	parse_cylinder(char *line, t_scene *scene)
 	char		*token;
 	t_cylinder	*cylinder;
 
-	if (scene->cylinder_count >= 100)
+	if (scene->cylinder_count + scene->group_cylinders >= OBJECT_SLOTS)
 		return (print_error("Too many cylinders"));
 	cylinder = &scene->cylinders[scene->cylinder_count];
 	token = line + 3;
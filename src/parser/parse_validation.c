@@ -35,6 +35,8 @@ int	in_range(double value, double min, double max)
 /*
 ** Parse 3D vector from comma-separated string.
 ** Format: "x,y,z" where x, y, z are floating point numbers.
+** The three numbers are one token: a comma is not searched for past a
+** blank, so "0,0 0,1,0" is an error instead of the vector (0, 0, 1).
 ** Returns 1 on success, 0 on parsing error.
 */
 /**
@@ -51,13 +53,13 @@ int	parse_vector(char *str, t_vec3 *vec)
 
 	token = str;
 	vec->x = ft_atof(token);
-	while (*token && *token != ',')
+	while (*token && *token != ',' && *token != ' ' && *token != '\t')
 		token++;
 	if (*token != ',')
 		return (0);
 	token++;
 	vec->y = ft_atof(token);
-	while (*token && *token != ',')
+	while (*token && *token != ',' && *token != ' ' && *token != '\t')
 		token++;
 	if (*token != ',')
 		return (0);
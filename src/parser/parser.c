@@ -13,6 +13,7 @@
 #include "minirt.h"
 #include "parser.h"
 #include "spatial.h"
+#include "window.h"
 #include <fcntl.h>
 #include <unistd.h>
 #include <stdlib.h>
@@ -47,9 +48,22 @@ static char	*read_line(int fd)
 	return (line);
 }
 
+/*
+** Ambient, camera and light lines inside gr ... ge. Planes, meshes,
+** instances and nested groups are rejected by their own parsers.
+*/
+static int	group_rejects(char *line, t_scene *scene)
+{
+	if (!scene->in_group || line[1] != ' ')
+		return (0);
+	return (line[0] == 'A' || line[0] == 'C' || line[0] == 'L');
+}
+
 /*
 ** Parse single line from scene file.
 ** Identifies element type by prefix and calls appropriate parser.
+** Spheres and cylinders inside gr ... ge become group members; no other
+** element can be part of a group.
 ** Returns 1 on success, 0 on error. Skips empty lines and comments.
 */
 /**
@@ -66,6 +80,8 @@ static int	parse_line(char *line, t_scene *scene)
 		line++;
 	if (*line == '\0' || *line == '\n' || *line == '#')
 		return (1);
+	if (group_rejects(line, scene))
+		return (print_error("Lights and cameras cannot be part of a group"));
 	if (line[0] == 'A' && line[1] == ' ')
 		return (parse_ambient(line, scene));
 	else if (line[0] == 'C' && line[1] == ' ')
@@ -73,12 +89,15 @@ static int	parse_line(char *line, t_scene *scene)
 	else if (line[0] == 'L' && line[1] == ' ')
 		return (parse_light(line, scene));
 	else if (line[0] == 's' && line[1] == 'p' && line[2] == ' ')
-		return (parse_sphere(line, scene));
+		return (parse_sphere(line, scene) && group_claim(scene, OBJ_SPHERE));
 	else if (line[0] == 'p' && line[1] == 'l' && line[2] == ' ')
 		return (parse_plane(line, scene));
 	else if (line[0] == 'c' && line[1] == 'y' && line[2] == ' ')
-		return (parse_cylinder(line, scene));
-	return (print_error("Invalid element identifier"));
+		return (parse_cylinder(line, scene)
+			&& group_claim(scene, OBJ_CYLINDER));
+	else if (line[0] == 'm' && line[1] == 'h' && line[2] == ' ')
+		return (parse_mesh(line, scene));
+	return (parse_group_line(line, scene));
 }
 
 /*
@@ -116,7 +135,7 @@ int	parse_scene(const char *filename, t_scene *scene)
 	close(fd);
 	if (success)
 	{
-		success = validate_scene(scene);
+		success = validate_scene(scene) && instances_build(scene);
 		if (success)
 			scene_build_bvh(scene);
 	}
@@ -125,7 +144,8 @@ int	parse_scene(const char *filename, t_scene *scene)
 
 /*
 ** Validate that scene contains all required elements.
-** Checks for ambient light, camera, light source, and at least one object.
+** Checks for ambient light, camera, light source, closed groups and at
+** least one object, instance or mesh.
 */
 /**
  * @brief validate scene 함수 - 검증 수행
@@ -142,8 +162,11 @@ int	validate_scene(t_scene *scene)
 		return (print_error("Missing camera (C)"));
 	if (!scene->has_light)
 		return (print_error("Missing light (L)"));
+	if (scene->in_group)
+		return (print_error("Group (gr) without end (ge)"));
 	if (scene->sphere_count == 0 && scene->plane_count == 0
-		&& scene->cylinder_count == 0)
+		&& scene->cylinder_count == 0 && scene->instance_count == 0
+		&& scene->mesh_count == 0)
 		return (print_error("No objects in scene"));
 	return (1);
 }
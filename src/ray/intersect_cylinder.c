@@ -13,117 +13,47 @@
 #include "minirt.h"
 #include "ray.h"
 #include "vec3.h"
-#include <math.h>
+#include <tgmath.h>
 
-/*
-** Calculate ray-cylinder infinite surface intersection.
-** Uses quadratic equation excluding cylinder caps.
-** Returns 1 if intersection found within cylinder height, 0 otherwise.
-*/
-static int	calculate_cylinder_intersection(t_ray *ray, t_cylinder *cyl,
-		t_cyl_calc *calc)
-{
-	t_vec3	oc;
-	double	dir_dot_axis;
-	double	oc_dot_axis;
-	double	dir_dot_dir;
-	double	oc_dot_oc;
-
-	oc = vec3_subtract(ray->origin, cyl->center);
-	dir_dot_axis = vec3_dot(ray->direction, cyl->axis);
-	oc_dot_axis = vec3_dot(oc, cyl->axis);
-	dir_dot_dir = vec3_dot(ray->direction, ray->direction);
-	oc_dot_oc = vec3_dot(oc, oc);
-	calc->a = dir_dot_dir - dir_dot_axis * dir_dot_axis;
-	calc->b = 2.0 * (vec3_dot(ray->direction, oc)
-			- dir_dot_axis * oc_dot_axis);
-	calc->c = oc_dot_oc - oc_dot_axis * oc_dot_axis - cyl->radius_squared;
-	calc->discriminant = calc->b * calc->b - 4 * calc->a * calc->c;
-	if (calc->discriminant < 0 || calc->a < EPSILON)
-		return (0);
-	calc->t = (-calc->b - sqrt(calc->discriminant)) / (2.0 * calc->a);
-	if (calc->t < 0.001)
-		calc->t = (-calc->b + sqrt(calc->discriminant)) / (2.0 * calc->a);
-	calc->m = dir_dot_axis * calc->t + oc_dot_axis;
-	return (1);
-}
-
-/*
-** Check ray intersection with cylinder cap (top or bottom disc).
-** Returns 1 if hit and updates hit info, 0 otherwise.
-*/
-int	intersect_cylinder_cap(t_ray *ray, t_cylinder *cyl, t_hit *hit,
-		double cap_m)
-{
-	t_vec3	cap_center;
-	double	denom;
-	double	t;
-	t_vec3	p;
-	double	dist_sq;
-
-	denom = vec3_dot(ray->direction, cyl->axis);
-	if (fabs(denom) < EPSILON)
-		return (0);
-	cap_center = vec3_add(cyl->center, vec3_multiply(cyl->axis, cap_m));
-	t = vec3_dot(vec3_subtract(cap_center, ray->origin), cyl->axis) / denom;
-	if (t < 0.001 || t > hit->distance)
-		return (0);
-	p = vec3_add(ray->origin, vec3_multiply(ray->direction, t));
-	dist_sq = vec3_dot(vec3_subtract(p, cap_center),
-			vec3_subtract(p, cap_center));
-	if (dist_sq > cyl->radius_squared)
-		return (0);
-	hit->distance = t;
-	hit->point = p;
-	hit->normal = cyl->axis;
-	if (vec3_dot(ray->direction, hit->normal) > 0)
-		hit->normal = vec3_multiply(hit->normal, -1.0);
-	hit->color = cyl->color;
-	return (1);
-}
-
-/*
-** Test ray-cylinder body intersection (side surface).
-** Returns 1 if hit and closer than current hit->distance, 0 otherwise.
-*/
 /**
- * @brief intersect cylinder body 함수 - 교차 검사 수행
+ * @brief cylinder slab 함수 - 두 뚜껑 평면 사이에 있는 광선 구간
  *
- * @param ray 파라미터
- * @param cyl 파라미터
- * @param hit 파라미터
+ * calc->da, calc->oa로 축 방향 위치 m = oa + t * da가 높이 안에 드는
+ * t 구간을 calc->slab에 둔다. 축에 수직인 광선은 높이 안이면 전체
+ * 직선이다.
  *
- * @return int 반환값
+ * @param cyl 원기둥
+ * @param calc da, oa가 채워진 계산 상태
+ *
+ * @return int 구간이 있으면 1
  */
-int	intersect_cylinder_body(t_ray *ray, t_cylinder *cyl, t_hit *hit)
+int	cylinder_slab(t_cylinder *cyl, t_cyl_calc *calc)
 {
-	t_cyl_calc	calc;
-	t_vec3		hit_point;
-	t_vec3		axis_point;
+	t_real	ta;
+	t_real	tb;
 
-	if (!calculate_cylinder_intersection(ray, cyl, &calc))
-		return (0);
-	if (calc.t < 0.001 || calc.t > hit->distance)
-		return (0);
-	hit_point = vec3_add(ray->origin, vec3_multiply(ray->direction, calc.t));
-	if (calc.m < -cyl->half_height || calc.m > cyl->half_height)
-		return (0);
-	hit->distance = calc.t;
-	hit->point = hit_point;
-	axis_point = vec3_add(cyl->center, vec3_multiply(cyl->axis, calc.m));
-	hit->normal = vec3_normalize(vec3_subtract(hit->point, axis_point));
-	hit->color = cyl->color;
+	if (fabs(calc->da) < EPSILON)
+	{
+		calc->slab[0] = -INFINITY;
+		calc->slab[1] = INFINITY;
+		return (fabs(calc->oa) <= cyl->half_height);
+	}
+	ta = (-cyl->half_height - calc->oa) / calc->da;
+	tb = (cyl->half_height - calc->oa) / calc->da;
+	calc->slab[0] = fmin(ta, tb);
+	calc->slab[1] = fmax(ta, tb);
 	return (1);
 }
 
 /*
 ** Test ray-cylinder intersection including body and caps.
-** Checks body, top cap, and bottom cap, returns closest hit.
 ** Returns 1 if hit and closer than current hit->distance, 0 otherwise.
 */
 /**
  * @brief intersect cylinder 함수 - 교차 검사 수행
  *
+ * 광선 원점 기준 항을 구해 intersect_cylinder_origin()으로 검사한다.
+ *
  * @param ray 파라미터
  * @param cylinder 파라미터
  * @param hit 파라미터
@@ -132,29 +62,10 @@ int	intersect_cylinder_body(t_ray *ray, t_cylinder *cyl, t_hit *hit)
  */
 int	intersect_cylinder(t_ray *ray, t_cylinder *cylinder, t_hit *hit)
 {
-	int		hit_found;
-	t_hit	temp_hit;
+	t_origin_term	term;
 
-	hit_found = 0;
-	temp_hit.distance = hit->distance;
-	if (intersect_cylinder_body(ray, cylinder, &temp_hit))
-	{
-		*hit = temp_hit;
-		hit_found = 1;
-	}
-	temp_hit.distance = hit->distance;
-	if (intersect_cylinder_cap(ray, cylinder, &temp_hit,
-			cylinder->half_height))
-	{
-		*hit = temp_hit;
-		hit_found = 1;
-	}
-	temp_hit.distance = hit->distance;
-	if (intersect_cylinder_cap(ray, cylinder, &temp_hit,
-			-cylinder->half_height))
-	{
-		*hit = temp_hit;
-		hit_found = 1;
-	}
-	return (hit_found);
+	term.oc = vec3_subtract(ray->origin, cylinder->center);
+	term.oc_axis = vec3_dot(term.oc, cylinder->axis);
+	term.c = vec3_dot(term.oc, term.oc) - cylinder->radius_squared;
+	return (intersect_cylinder_origin(ray, cylinder, &term, hit));
 }
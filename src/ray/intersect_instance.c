@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   intersect_instance.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/08 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/08 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minirt.h"
+#include "ray.h"
+#include "window.h"
+#include <math.h>
+
+/**
+ * @brief instance shift 함수 - 그룹 공간 광선의 원점 이동 거리
+ *
+ * 교차 함수는 그룹 공간에서 HIT_EPSILON보다 가까운 교차를 버리는데,
+ * 이는 월드 거리 HIT_EPSILON * s 이다. 원점을 이 거리만큼 뒤로 옮기면
+ * 그룹 공간 거리 t가 t + shift로 보여, 월드 거리 HIT_EPSILON에서
+ * 잘린다.
+ *
+ * @param inst 인스턴스
+ *
+ * @return t_real HIT_EPSILON - HIT_EPSILON / s (그룹 공간)
+ */
+t_real	instance_shift(t_instance *inst)
+{
+	return (HIT_EPSILON - HIT_EPSILON / inst->scale);
+}
+
+/**
+ * @brief instance ray 함수 - 월드 광선을 그룹 공간으로 변환
+ *
+ * o' = R^T (o - p) / s - shift d', d' = R^T d. 방향은 단위 벡터로
+ * 남으므로 그룹 공간 거리에서 shift를 빼면 월드 거리 / s 이다.
+ *
+ * @param inst 인스턴스
+ * @param origin 월드 광선 원점
+ * @param dir 월드 광선 방향 (단위 벡터)
+ *
+ * @return t_ray 그룹 공간 광선
+ */
+t_ray	instance_ray(t_instance *inst, t_vec3 origin, t_vec3 dir)
+{
+	t_ray	local;
+	t_vec3	d;
+
+	d = vec3_multiply(vec3_subtract(origin, inst->position),
+			1 / inst->scale);
+	local.origin = (t_vec3){vec3_dot(d, inst->basis[0]),
+		vec3_dot(d, inst->basis[1]), vec3_dot(d, inst->basis[2])};
+	local.direction = (t_vec3){vec3_dot(dir, inst->basis[0]),
+		vec3_dot(dir, inst->basis[1]), vec3_dot(dir, inst->basis[2])};
+	local.origin = vec3_subtract(local.origin,
+			vec3_multiply(local.direction, instance_shift(inst)));
+	return (local);
+}
+
+/**
+ * @brief intersect instance 함수 - 인스턴스 교차 검사
+ *
+ * 광선을 그룹 공간으로 옮겨 그룹 BVH를 탐색하고, 교차점과 법선을
+ * 월드 좌표로 되돌린다. 다른 교차 함수처럼 hit->distance보다 가까울
+ * 때만 hit를 갱신하고, 자기 교차 한계도 월드 거리 HIT_EPSILON이다.
+ *
+ * @param scene 파라미터
+ * @param index 인스턴스 인덱스
+ * @param ray 월드 광선
+ * @param hit 파라미터
+ *
+ * @return int 더 가까운 교차가 있으면 1
+ */
+int	intersect_instance(t_scene *scene, int index, t_ray *ray, t_hit *hit)
+{
+	t_instance	*inst;
+	t_hit		local;
+	t_real		bound;
+	t_real		shift;
+
+	inst = &scene->instances[index];
+	shift = instance_shift(inst);
+	bound = hit->distance / inst->scale + shift;
+	local.distance = bound;
+	if (!bvh_intersect(scene->groups[inst->group].bvh,
+			instance_ray(inst, ray->origin, ray->direction), &local, scene)
+		|| local.distance > bound)
+		return (0);
+	hit->distance = (local.distance - shift) * inst->scale;
+	hit->point = vec3_add(ray->origin,
+			vec3_multiply(ray->direction, hit->distance));
+	hit->normal = vec3_add(vec3_multiply(inst->basis[0], local.normal.x),
+			vec3_add(vec3_multiply(inst->basis[1], local.normal.y),
+				vec3_multiply(inst->basis[2], local.normal.z)));
+	hit->color = local.color;
+	return (1);
+}
+
+/**
+ * @brief check instance intersections 함수 - 모든 인스턴스 검사
+ *
+ * BVH를 쓰지 않을 때 trace_ray가 사용한다.
+ *
+ * @param scene 파라미터
+ * @param ray 파라미터
+ * @param hit 파라미터
+ *
+ * @return int 반환값
+ */
+int	check_instance_intersections(t_scene *scene, t_ray *ray, t_hit *hit)
+{
+	int	i;
+	int	hit_found;
+
+	hit_found = 0;
+	i = 0;
+	while (i < scene->instance_count)
+	{
+		if (intersect_instance(scene, i, ray, hit))
+		{
+			hit->obj_type = OBJ_INSTANCE;
+			hit->obj_index = i;
+			hit_found = 1;
+		}
+		i++;
+	}
+	return (hit_found);
+}
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   intersect_origin.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/31 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/31 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "ray.h"
+#include "vec3.h"
+#include <tgmath.h>
+
+/*
+** Ray-sphere test for a ray starting at the terms' origin.
+** oc and |oc|² - r² come from the term; only the direction-dependent
+** part of the quadratic is computed per ray.
+*/
+/**
+ * @brief intersect sphere origin 함수 - 교차 검사 수행
+ *
+ * @param ray 파라미터
+ * @param sphere 파라미터
+ * @param term 원점 기준 항
+ * @param hit 파라미터
+ *
+ * @return int 반환값
+ */
+int	intersect_sphere_origin(t_ray *ray, t_sphere *sphere,
+		t_origin_term *term, t_hit *hit)
+{
+	t_real	a;
+	t_real	b;
+	t_real	discriminant;
+	t_real	t;
+
+	a = vec3_dot(ray->direction, ray->direction);
+	b = 2 * vec3_dot(term->oc, ray->direction);
+	discriminant = b * b - 4 * a * term->c;
+	if (discriminant < 0)
+		return (0);
+	t = (-b - sqrt(discriminant)) / (2 * a);
+	if (t < HIT_EPSILON)
+		t = (-b + sqrt(discriminant)) / (2 * a);
+	if (t < HIT_EPSILON || t > hit->distance)
+		return (0);
+	hit->distance = t;
+	hit->point = vec3_add(ray->origin, vec3_multiply(ray->direction, t));
+	hit->normal = vec3_normalize(vec3_subtract(hit->point, sphere->center));
+	hit->color = sphere->color;
+	return (1);
+}
+
+/*
+** Ray-plane test for a ray starting at the terms' origin:
+** t = -((O - P) . n) / (d . n).
+*/
+/**
+ * @brief intersect plane origin 함수 - 교차 검사 수행
+ *
+ * @param ray 파라미터
+ * @param plane 파라미터
+ * @param term 원점 기준 항
+ * @param hit 파라미터
+ *
+ * @return int 반환값
+ */
+int	intersect_plane_origin(t_ray *ray, t_plane *plane, t_origin_term *term,
+		t_hit *hit)
+{
+	t_real	denom;
+	t_real	t;
+
+	denom = vec3_dot(plane->normal, ray->direction);
+	if (fabs(denom) < PARALLEL_EPSILON)
+		return (0);
+	t = -term->oc_axis / denom;
+	if (t < HIT_EPSILON || t > hit->distance)
+		return (0);
+	hit->distance = t;
+	hit->point = vec3_add(ray->origin, vec3_multiply(ray->direction, t));
+	hit->normal = plane->normal;
+	if (vec3_dot(ray->direction, hit->normal) > 0)
+		hit->normal = vec3_multiply(hit->normal, -1);
+	hit->color = plane->color;
+	return (1);
+}
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   intersect_origin_cyl.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/31 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/31 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "ray.h"
+#include "vec3.h"
+#include <tgmath.h>
+
+/*
+** Bounding sphere (center C, radius sqrt(r^2 + h^2)): the ray misses it,
+** or starts outside it and points away. No square root.
+*/
+static int	sphere_rejects(t_ray *ray, t_cylinder *cyl, t_origin_term *term)
+{
+	t_real	b;
+	t_real	c;
+
+	b = vec3_dot(ray->direction, term->oc);
+	c = term->c - cyl->half_height * cyl->half_height;
+	if (c > 0 && b > 0)
+		return (1);
+	return (b * b - vec3_dot(ray->direction, ray->direction) * c < 0);
+}
+
+/*
+** Side surface quadratic with oc, oc . axis and |oc|^2 - r^2 taken from
+** the term (half-b form): both roots in calc->body. A ray parallel to
+** the axis is inside along its whole line, or never.
+*/
+static int	body_range(t_ray *ray, t_cylinder *cyl, t_origin_term *term,
+		t_cyl_calc *calc)
+{
+	t_real	a;
+	t_real	b;
+	t_real	c;
+	t_real	disc;
+
+	calc->da = vec3_dot(ray->direction, cyl->axis);
+	calc->oa = term->oc_axis;
+	a = vec3_dot(ray->direction, ray->direction) - calc->da * calc->da;
+	b = vec3_dot(ray->direction, term->oc) - calc->da * calc->oa;
+	c = term->c - calc->oa * calc->oa;
+	calc->body[0] = -INFINITY;
+	calc->body[1] = INFINITY;
+	if (a < EPSILON)
+		return (c <= 0);
+	disc = b * b - a * c;
+	if (disc < 0)
+		return (0);
+	disc = sqrt(disc);
+	calc->body[0] = (-b - disc) / a;
+	calc->body[1] = (-b + disc) / a;
+	return (1);
+}
+
+/*
+** Point, normal and color at hit->distance: the axis (facing the ray)
+** on a cap, away from the axis on the side surface.
+*/
+static void	fill_hit(t_ray *ray, t_cylinder *cyl, t_cyl_calc *calc,
+		t_hit *hit)
+{
+	t_vec3	axis_point;
+
+	hit->point = vec3_add(ray->origin,
+			vec3_multiply(ray->direction, hit->distance));
+	if (calc->cap)
+	{
+		hit->normal = cyl->axis;
+		if (calc->da > 0)
+			hit->normal = vec3_multiply(hit->normal, -1.0);
+	}
+	else
+	{
+		axis_point = vec3_add(cyl->center, vec3_multiply(cyl->axis,
+					calc->oa + calc->da * hit->distance));
+		hit->normal = vec3_normalize(vec3_subtract(hit->point, axis_point));
+	}
+	hit->color = cyl->color;
+}
+
+/*
+** Ray-cylinder test for a ray starting at the terms' origin.
+** The ray is inside the finite cylinder where the body and slab ranges
+** overlap; the hit is the entry (or, from inside, the exit) and lies on
+** a cap when that end of the overlap comes from the slab.
+*/
+/**
+ * @brief intersect cylinder origin 함수 - 교차 검사 수행
+ *
+ * 경계 구로 먼저 거르고, 몸통 이차식 하나와 뚜껑 평면 구간 하나로
+ * 몸통과 뚜껑을 함께 푼다.
+ *
+ * @param ray 파라미터
+ * @param cyl 파라미터
+ * @param term 원점 기준 항
+ * @param hit 파라미터
+ *
+ * @return int 반환값
+ */
+int	intersect_cylinder_origin(t_ray *ray, t_cylinder *cyl,
+		t_origin_term *term, t_hit *hit)
+{
+	t_cyl_calc	calc;
+	t_real		lo;
+	t_real		hi;
+	t_real		t;
+
+	if (sphere_rejects(ray, cyl, term) || !body_range(ray, cyl, term, &calc)
+		|| !cylinder_slab(cyl, &calc))
+		return (0);
+	lo = fmax(calc.body[0], calc.slab[0]);
+	hi = fmin(calc.body[1], calc.slab[1]);
+	t = lo;
+	calc.cap = (calc.slab[0] > calc.body[0]);
+	if (t < HIT_EPSILON)
+	{
+		t = hi;
+		calc.cap = (calc.slab[1] < calc.body[1]);
+	}
+	if (lo > hi || t < HIT_EPSILON || t > hit->distance)
+		return (0);
+	hit->distance = t;
+	fill_hit(ray, cyl, &calc, hit);
+	return (1);
+}
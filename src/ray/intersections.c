@@ -13,7 +13,7 @@
 #include "minirt.h"
 #include "ray.h"
 #include "vec3.h"
-#include <math.h>
+#include <tgmath.h>
 
 /*
 ** Calculate ray-sphere intersection distance using quadratic formula.
@@ -27,25 +27,25 @@
  * @param ray 파라미터
  * @param radius_squared 파라미터
  *
- * @return double 반환값
+ * @return t_real 반환값
  */
-static double	calculate_sphere_t(t_vec3 oc, t_ray *ray, double radius_squared)
+static t_real	calculate_sphere_t(t_vec3 oc, t_ray *ray, t_real radius_squared)
 {
-	double	a;
-	double	b;
-	double	c;
-	double	discriminant;
-	double	t;
+	t_real	a;
+	t_real	b;
+	t_real	c;
+	t_real	discriminant;
+	t_real	t;
 
 	a = vec3_dot(ray->direction, ray->direction);
-	b = 2.0 * vec3_dot(oc, ray->direction);
+	b = 2 * vec3_dot(oc, ray->direction);
 	c = vec3_dot(oc, oc) - radius_squared;
 	discriminant = b * b - 4 * a * c;
 	if (discriminant < 0)
 		return (-1);
-	t = (-b - sqrt(discriminant)) / (2.0 * a);
-	if (t < 0.001)
-		t = (-b + sqrt(discriminant)) / (2.0 * a);
+	t = (-b - sqrt(discriminant)) / (2 * a);
+	if (t < HIT_EPSILON)
+		t = (-b + sqrt(discriminant)) / (2 * a);
 	return (t);
 }
 
@@ -66,11 +66,11 @@ static double	calculate_sphere_t(t_vec3 oc, t_ray *ray, double radius_squared)
 int	intersect_sphere(t_ray *ray, t_sphere *sphere, t_hit *hit)
 {
 	t_vec3	oc;
-	double	t;
+	t_real	t;
 
 	oc = vec3_subtract(ray->origin, sphere->center);
 	t = calculate_sphere_t(oc, ray, sphere->radius_squared);
-	if (t < 0.001 || t > hit->distance)
+	if (t < HIT_EPSILON || t > hit->distance)
 		return (0);
 	hit->distance = t;
 	hit->point = vec3_add(ray->origin, vec3_multiply(ray->direction, t));
@@ -95,16 +95,16 @@ int	intersect_sphere(t_ray *ray, t_sphere *sphere, t_hit *hit)
  */
 int	intersect_plane(t_ray *ray, t_plane *plane, t_hit *hit)
 {
-	double	denom;
-	double	t;
+	t_real	denom;
+	t_real	t;
 	t_vec3	p0l0;
 
 	denom = vec3_dot(plane->normal, ray->direction);
-	if (fabs(denom) < 0.0001)
+	if (fabs(denom) < PARALLEL_EPSILON)
 		return (0);
 	p0l0 = vec3_subtract(plane->point, ray->origin);
 	t = vec3_dot(p0l0, plane->normal) / denom;
-	if (t < 0.001 || t > hit->distance)
+	if (t < HIT_EPSILON || t > hit->distance)
 		return (0);
 	hit->distance = t;
 	hit->point = vec3_add(ray->origin, vec3_multiply(ray->direction, t));
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   origin_terms.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/31 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/31 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "ray.h"
+#include "window.h"
+
+/*
+** Fill the origin terms of one object.
+*/
+static void	set_term(t_origin_term *term, t_vec3 oc, t_vec3 axis,
+		t_real radius_squared)
+{
+	term->oc = oc;
+	term->oc_axis = vec3_dot(oc, axis);
+	term->c = vec3_dot(oc, oc) - radius_squared;
+}
+
+/*
+** Slot i holds a world object (i < count) or a group member (the last
+** members slots, see t_group).
+*/
+static int	slot_used(int i, int count, int members)
+{
+	return (i < count || i >= OBJECT_SLOTS - members);
+}
+
+/**
+ * @brief origin terms update 함수 - 원점 기준 항 계산
+ *
+ * 그룹 멤버 칸도 같은 원점으로 채운다. 그룹 공간 광선의 원점이 우연히
+ * 같아도 올바른 항을 쓰게 된다.
+ *
+ * @param terms 출력 항 배열
+ * @param scene 파라미터
+ * @param origin 광선 공통 원점 (카메라 또는 광원)
+ */
+void	origin_terms_update(t_origin_terms *terms, t_scene *scene,
+		t_vec3 origin)
+{
+	int	i;
+
+	terms->origin = origin;
+	i = 0;
+	while (i < ORIGIN_TERMS)
+	{
+		if (slot_used(i, scene->sphere_count, scene->group_spheres))
+			set_term(&terms->spheres[i], vec3_subtract(origin,
+					scene->spheres[i].center), (t_vec3){0, 0, 0},
+				scene->spheres[i].radius_squared);
+		if (i < scene->plane_count)
+			set_term(&terms->planes[i], vec3_subtract(origin,
+					scene->planes[i].point), scene->planes[i].normal, 0.0);
+		if (slot_used(i, scene->cylinder_count, scene->group_cylinders))
+			set_term(&terms->cylinders[i], vec3_subtract(origin,
+					scene->cylinders[i].center), scene->cylinders[i].axis,
+				scene->cylinders[i].radius_squared);
+		i++;
+	}
+}
+
+/**
+ * @brief trace frame prepare 함수 - 프레임별 광선 사전 계산
+ *
+ * 모든 1차 광선은 카메라 위치에서, 그림자 광선은 광원에서 출발하므로
+ * 원점에만 의존하는 항을 프레임마다 한 번 계산한다.
+ *
+ * @param scene 파라미터
+ */
+void	trace_frame_prepare(t_scene *scene)
+{
+	shadow_frame_prepare(scene);
+	origin_terms_update(&scene->primary_origin, scene,
+		scene->camera.position);
+}
+
+/**
+ * @brief intersect scene object 함수 - 객체 하나와 교차 검사
+ *
+ * 광선이 1차 광선 원점(카메라)에서 출발하면 사전 계산 항을 쓰는
+ * 커널을, 아니면 일반 교차 함수를 사용한다. 인스턴스는 그룹 BVH로
+ * 넘긴다.
+ *
+ * @param scene 파라미터
+ * @param ref 객체 종류와 인덱스
+ * @param ray 파라미터
+ * @param hit 파라미터
+ *
+ * @return int 더 가까운 교차가 있으면 1
+ */
+int	intersect_scene_object(t_scene *scene, t_object_ref ref, t_ray *ray,
+		t_hit *hit)
+{
+	t_origin_terms	*t;
+
+	if (ref.type == OBJ_INSTANCE)
+		return (intersect_instance(scene, ref.index, ray, hit));
+	if (ref.type == OBJ_MESH)
+		return (intersect_mesh(scene, ref.index, ray, hit));
+	t = &scene->primary_origin;
+	if (ray->origin.x != t->origin.x || ray->origin.y != t->origin.y
+		|| ray->origin.z != t->origin.z)
+		t = NULL;
+	if (ref.type == OBJ_SPHERE && t)
+		return (intersect_sphere_origin(ray, &scene->spheres[ref.index],
+				&t->spheres[ref.index], hit));
+	if (ref.type == OBJ_SPHERE)
+		return (intersect_sphere(ray, &scene->spheres[ref.index], hit));
+	if (ref.type == OBJ_PLANE && t)
+		return (intersect_plane_origin(ray, &scene->planes[ref.index],
+				&t->planes[ref.index], hit));
+	if (ref.type == OBJ_PLANE)
+		return (intersect_plane(ray, &scene->planes[ref.index], hit));
+	if (ref.type == OBJ_CYLINDER && t)
+		return (intersect_cylinder_origin(ray, &scene->cylinders[ref.index],
+				&t->cylinders[ref.index], hit));
+	return (intersect_cylinder(ray, &scene->cylinders[ref.index], hit));
+}
@@ -14,7 +14,7 @@
 #include "window.h"
 #include "vec3.h"
 #include "ray.h"
-#include <math.h>
+#include <tgmath.h>
 
 /*
 ** Initialize camera coordinate system (right and up vectors).
@@ -22,20 +22,47 @@
 ** Assumes world up is (0, 1, 0) for calculating right vector.
 */
 /**
- * @brief init camera calc 함수 - 초기화 수행
+ * @brief camera calc init 함수 - 초기화 수행
  *
  * @param camera 파라미터
  * @param calc 파라미터
  */
-static void	init_camera_calc(t_camera *camera, t_cam_calc *calc)
+void	camera_calc_init(t_camera *camera, t_cam_calc *calc)
 {
 	calc->aspect_ratio = ASPECT_RATIO_NUM / ASPECT_RATIO_DEN;
-	calc->fov_scale = tan(camera->fov * 0.5 * M_PI / 180.0);
+	calc->fov_scale = tan(camera->fov / 2 * (t_real)M_PI / 180);
 	calc->right = vec3_normalize(vec3_cross(camera->direction,
 				(t_vec3){0, 1, 0}));
 	calc->up = vec3_normalize(vec3_cross(calc->right, camera->direction));
 }
 
+/*
+** Normalized direction of the ray through NDC point (x, y) for a camera
+** whose basis is already in calc.
+*/
+/**
+ * @brief camera ray direction 함수 - 광선 방향 계산
+ *
+ * @param camera 파라미터
+ * @param calc camera_calc_init() 결과
+ * @param x 파라미터
+ * @param y 파라미터
+ *
+ * @return t_vec3 정규화된 방향
+ */
+t_vec3	camera_ray_direction(t_camera *camera, t_cam_calc *calc, t_real x,
+		t_real y)
+{
+	t_vec3	pixel_pos;
+
+	pixel_pos = camera->direction;
+	pixel_pos = vec3_add(pixel_pos, vec3_multiply(calc->right,
+				x * calc->fov_scale * calc->aspect_ratio));
+	pixel_pos = vec3_add(pixel_pos, vec3_multiply(calc->up,
+				y * calc->fov_scale));
+	return (vec3_normalize(pixel_pos));
+}
+
 /*
 ** Create camera ray for pixel at normalized coordinates (x, y).
 ** x, y in range [-1, 1] where (0,0) is center of screen.
@@ -50,19 +77,45 @@ static void	init_camera_calc(t_camera *camera, t_cam_calc *calc)
  *
  * @return t_ray 반환값
  */
-t_ray	create_camera_ray(t_camera *camera, double x, double y)
+t_ray	create_camera_ray(t_camera *camera, t_real x, t_real y)
 {
 	t_ray		ray;
-	t_vec3		pixel_pos;
 	t_cam_calc	calc;
 
-	init_camera_calc(camera, &calc);
-	pixel_pos = camera->direction;
-	pixel_pos = vec3_add(pixel_pos, vec3_multiply(calc.right,
-				x * calc.fov_scale * calc.aspect_ratio));
-	pixel_pos = vec3_add(pixel_pos, vec3_multiply(calc.up,
-				y * calc.fov_scale));
+	camera_calc_init(camera, &calc);
 	ray.origin = camera->position;
-	ray.direction = vec3_normalize(pixel_pos);
+	ray.direction = camera_ray_direction(camera, &calc, x, y);
 	return (ray);
 }
+
+/*
+** Project world point p to pixel coordinates (inverse of
+** create_camera_ray: pixel x maps to NDC 2x / WINDOW_WIDTH - 1).
+** Returns 0 for points at or behind the camera plane.
+*/
+/**
+ * @brief camera project 함수 - 월드 좌표를 화면 좌표로 투영
+ *
+ * @param camera 파라미터
+ * @param calc camera_calc_init() 결과
+ * @param p 월드 좌표
+ * @param px 픽셀 좌표 출력 (x, y)
+ *
+ * @return int 카메라 앞이면 1
+ */
+int	camera_project(t_camera *camera, t_cam_calc *calc, t_vec3 p, t_real *px)
+{
+	t_vec3	d;
+	t_real	z;
+
+	d = vec3_subtract(p, camera->position);
+	z = vec3_dot(d, camera->direction);
+	if (z <= EPSILON)
+		return (0);
+	z /= vec3_dot(camera->direction, camera->direction);
+	px[0] = (vec3_dot(d, calc->right) / (z * calc->fov_scale
+				* calc->aspect_ratio) + 1) * WINDOW_WIDTH / 2;
+	px[1] = (1 - vec3_dot(d, calc->up) / (z * calc->fov_scale))
+		* WINDOW_HEIGHT / 2;
+	return (1);
+}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frame_cache.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/29 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/29 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "frame_cache.h"
+#include <stdlib.h>
+#include <math.h>
+
+/**
+ * @brief frame cache init 함수 - 초기화 수행
+ *
+ * @param cache 파라미터
+ */
+void	frame_cache_init(t_frame_cache *cache)
+{
+	int	i;
+
+	i = 0;
+	while (i < FRAME_CACHE_SLOTS)
+	{
+		cache->slots[i].color = NULL;
+		cache->slots[i].pick = NULL;
+		cache->slots[i].depth = NULL;
+		cache->slots[i].last_used = 0;
+		i++;
+	}
+	cache->clock = 0;
+	cache->hits = 0;
+	cache->misses = 0;
+	cache->bytes = 0;
+}
+
+/**
+ * @brief frame cache free 함수 - 정리 수행
+ *
+ * @param cache 파라미터
+ */
+void	frame_cache_free(t_frame_cache *cache)
+{
+	int	i;
+
+	i = 0;
+	while (i < FRAME_CACHE_SLOTS)
+	{
+		free(cache->slots[i].color);
+		free(cache->slots[i].pick);
+		free(cache->slots[i].depth);
+		i++;
+	}
+	frame_cache_init(cache);
+}
+
+/**
+ * @brief frame key build 함수 - 캐시 키 생성
+ *
+ * 카메라 위치/방향과 광원 위치를 양자화하므로 이동 후 되돌아온
+ * 시점도 부동소수점 오차와 관계없이 같은 키가 된다.
+ *
+ * @param scene 파라미터
+ * @param key 출력 키
+ */
+void	frame_key_build(t_scene *scene, t_frame_key *key)
+{
+	t_vec3	v[3];
+	int		i;
+
+	v[0] = scene->camera.position;
+	v[1] = scene->camera.direction;
+	v[2] = scene->light.position;
+	i = 0;
+	while (i < 3)
+	{
+		key->q[i * 3] = (long)floor((double)v[i].x * FRAME_KEY_SCALE + 0.5);
+		key->q[i * 3 + 1] = (long)floor((double)v[i].y * FRAME_KEY_SCALE + 0.5);
+		key->q[i * 3 + 2] = (long)floor((double)v[i].z * FRAME_KEY_SCALE + 0.5);
+		i++;
+	}
+	key->q[9] = scene->render_state.edit_generation;
+}
+
+/*
+** FNV-1a over the key words.
+*/
+static unsigned long	frame_key_hash(t_frame_key *key)
+{
+	unsigned long	hash;
+	int				i;
+
+	hash = 14695981039346656037UL;
+	i = 0;
+	while (i < FRAME_KEY_WORDS)
+	{
+		hash ^= (unsigned long)key->q[i];
+		hash *= 1099511628211UL;
+		i++;
+	}
+	return (hash);
+}
+
+/**
+ * @brief frame cache find 함수 - 키에 해당하는 슬롯 찾기
+ *
+ * 해시가 같을 때만 키 전체를 비교한다.
+ *
+ * @param cache 파라미터
+ * @param key 파라미터
+ * @param hash 키 해시 출력
+ *
+ * @return int 슬롯 번호, 없으면 -1
+ */
+int	frame_cache_find(t_frame_cache *cache, t_frame_key *key,
+		unsigned long *hash)
+{
+	t_frame_slot	*slot;
+	int				i;
+	int				w;
+
+	*hash = frame_key_hash(key);
+	i = 0;
+	while (i < FRAME_CACHE_SLOTS)
+	{
+		slot = &cache->slots[i];
+		w = 0;
+		while (slot->color && slot->hash == *hash && w < FRAME_KEY_WORDS
+			&& slot->key.q[w] == key->q[w])
+			w++;
+		if (w == FRAME_KEY_WORDS)
+			return (i);
+		i++;
+	}
+	return (-1);
+}
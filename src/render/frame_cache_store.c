@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frame_cache_store.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/29 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/29 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "frame_cache.h"
+#include "window.h"
+#include "metrics.h"
+#include "utils.h"
+#include <stdlib.h>
+
+/*
+** Allocate the buffers of an empty slot. Returns 0 if out of memory
+** (the frame is simply not cached).
+*/
+static int	slot_alloc(t_frame_cache *cache, t_frame_slot *slot)
+{
+	size_t	count;
+
+	count = (size_t)WINDOW_WIDTH * WINDOW_HEIGHT;
+	slot->color = malloc(sizeof(unsigned int) * count);
+	slot->pick = malloc(sizeof(int) * count);
+	slot->depth = malloc(sizeof(float) * count);
+	if (!slot->color || !slot->pick || !slot->depth)
+	{
+		free(slot->color);
+		free(slot->pick);
+		free(slot->depth);
+		slot->color = NULL;
+		slot->pick = NULL;
+		slot->depth = NULL;
+		return (0);
+	}
+	cache->bytes += (sizeof(unsigned int) + sizeof(int) + sizeof(float))
+		* count;
+	return (1);
+}
+
+/*
+** First empty slot, otherwise the least recently used one.
+*/
+static int	slot_victim(t_frame_cache *cache)
+{
+	int	victim;
+	int	i;
+
+	victim = 0;
+	i = 0;
+	while (i < FRAME_CACHE_SLOTS)
+	{
+		if (!cache->slots[i].color)
+			return (i);
+		if (cache->slots[i].last_used < cache->slots[victim].last_used)
+			victim = i;
+		i++;
+	}
+	return (victim);
+}
+
+/*
+** Copy color, pick ids and depth between the screen buffers (side 0)
+** and a slot (side 1). Pick ids and depth are optional on screen.
+*/
+static void	slot_copy(t_render *render, t_frame_slot *slot, int to_slot)
+{
+	char	*side[2];
+	size_t	count;
+	int		y;
+
+	count = (size_t)WINDOW_WIDTH * WINDOW_HEIGHT;
+	y = 0;
+	while (y < WINDOW_HEIGHT)
+	{
+		side[0] = render->img_data + y * render->size_line;
+		side[1] = (char *)(slot->color + y * WINDOW_WIDTH);
+		ft_memcpy(side[to_slot], side[!to_slot],
+			sizeof(unsigned int) * WINDOW_WIDTH);
+		y++;
+	}
+	side[0] = (char *)render->pick_ids;
+	side[1] = (char *)slot->pick;
+	if (render->pick_ids)
+		ft_memcpy(side[to_slot], side[!to_slot], sizeof(int) * count);
+	side[0] = (char *)render->reproj.depth;
+	side[1] = (char *)slot->depth;
+	if (render->reproj.depth)
+		ft_memcpy(side[to_slot], side[!to_slot], sizeof(float) * count);
+}
+
+/**
+ * @brief frame cache store 함수 - 완성된 프레임 저장
+ *
+ * @param cache 파라미터
+ * @param render 파라미터
+ */
+void	frame_cache_store(t_frame_cache *cache, t_render *render)
+{
+	t_frame_key		key;
+	t_frame_slot	*slot;
+	unsigned long	hash;
+	int				i;
+
+	frame_key_build(render->scene, &key);
+	i = frame_cache_find(cache, &key, &hash);
+	if (i < 0)
+		i = slot_victim(cache);
+	slot = &cache->slots[i];
+	if (!slot->color && !slot_alloc(cache, slot))
+		return ;
+	slot->key = key;
+	slot->hash = hash;
+	slot->last_used = ++cache->clock;
+	slot_copy(render, slot, 1);
+}
+
+/**
+ * @brief frame cache restore 함수 - 캐시된 프레임을 화면에 복원
+ *
+ * 복원한 프레임은 완성된 전체 품질 프레임이므로 재투영 원본이 되고
+ * 손상 영역도 비운다. 복원 시간은 프레임 시간으로 기록된다.
+ *
+ * @param cache 파라미터
+ * @param render 파라미터
+ *
+ * @return int 적중하면 1
+ */
+int	frame_cache_restore(t_frame_cache *cache, t_render *render)
+{
+	t_frame_key		key;
+	t_frame_slot	*slot;
+	unsigned long	hash;
+	struct timeval	start;
+	int				i;
+
+	timer_start(&start);
+	frame_key_build(render->scene, &key);
+	i = frame_cache_find(cache, &key, &hash);
+	if (i < 0)
+	{
+		cache->misses++;
+		return (0);
+	}
+	cache->hits++;
+	slot = &cache->slots[i];
+	slot->last_used = ++cache->clock;
+	slot_copy(render, slot, 0);
+	reproject_frame_done(&render->reproj, &render->scene->camera, 1, 0);
+	damage_reset(&render->damage);
+	render->view_valid = 0;
+	render->scene->render_state.metrics.render_time_us
+		= timer_elapsed_us(&start);
+	render->scene->render_state.metrics.redraw_percent = 0;
+	return (1);
+}
@@ -28,7 +28,15 @@ void	metrics_init(t_metrics *metrics)
 	metrics->intersect_tests = 0;
 	metrics->bvh_nodes_visited = 0;
 	metrics->bvh_tests_skipped = 0;
+	metrics->shadow_hits = 0;
+	metrics->shadow_samples = 0;
+	metrics->shadow_cache_misses = 0;
+	metrics->shadow_cache_hits = 0;
+	metrics->packet_lanes = 0;
+	metrics->packet_slots = 0;
+	metrics->hud_time_us = 0;
 	metrics->quality_mode = 0;
+	metrics->redraw_percent = 100;
 	i = 0;
 	while (i < 60)
 	{
@@ -50,6 +58,12 @@ void	metrics_start_frame(t_metrics *metrics)
 	metrics->bvh_nodes_visited = 0;
 	metrics->bvh_tests_skipped = 0;
 	metrics->bvh_box_tests = 0;
+	metrics->shadow_hits = 0;
+	metrics->shadow_samples = 0;
+	metrics->shadow_cache_misses = 0;
+	metrics->shadow_cache_hits = 0;
+	metrics->packet_lanes = 0;
+	metrics->packet_slots = 0;
 	timer_start(&metrics->start_time);
 }
 
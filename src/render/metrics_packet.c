@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   metrics_packet.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/02 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/02 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "metrics.h"
+
+/**
+ * @brief metrics add packet 함수 - 추가 수행
+ *
+ * 광선 묶음이 노드나 객체 하나를 검사할 때마다 한 번 호출된다.
+ *
+ * @param metrics 파라미터
+ * @param mask 활성 레인 비트 마스크
+ * @param lanes 묶음의 레인 수
+ */
+void	metrics_add_packet(t_metrics *metrics, int mask, int lanes)
+{
+	if (!metrics)
+		return ;
+	while (mask)
+	{
+		metrics->packet_lanes++;
+		mask &= mask - 1;
+	}
+	metrics->packet_slots += lanes;
+}
+
+/**
+ * @brief calculate packet utilization 함수 - 계산 수행
+ *
+ * @param m 파라미터
+ *
+ * @return double 묶음 검사에서 활성 레인의 비율 (%)
+ */
+double	calculate_packet_utilization(t_metrics *m)
+{
+	if (m->packet_slots == 0)
+		return (0.0);
+	return (100.0 * m->packet_lanes / m->packet_slots);
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   metrics_shadow.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/21 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/21 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "metrics.h"
+
+/**
+ * @brief metrics add shadow samples 함수 - 추가 수행
+ *
+ * @param metrics 파라미터
+ * @param samples 이번 히트 포인트에서 발사한 그림자 광선 수
+ */
+void	metrics_add_shadow_samples(t_metrics *metrics, int samples)
+{
+	if (metrics)
+	{
+		metrics->shadow_hits++;
+		metrics->shadow_samples += samples;
+	}
+}
+
+/**
+ * @brief calculate avg shadow samples 함수 - 계산 수행
+ *
+ * @param m 파라미터
+ *
+ * @return double 히트 포인트당 평균 그림자 샘플 수
+ */
+double	calculate_avg_shadow_samples(t_metrics *m)
+{
+	if (m->shadow_hits == 0)
+		return (0.0);
+	return ((double)m->shadow_samples / m->shadow_hits);
+}
+
+/**
+ * @brief metrics add shadow cache 함수 - 추가 수행
+ *
+ * 가려진 그림자 광선마다 한 번 호출된다.
+ *
+ * @param metrics 파라미터
+ * @param hit 캐시된 차폐물이 광선을 가렸으면 1, 전체 탐색이 필요했으면 0
+ */
+void	metrics_add_shadow_cache(t_metrics *metrics, int hit)
+{
+	if (!metrics)
+		return ;
+	if (hit)
+		metrics->shadow_cache_hits++;
+	else
+		metrics->shadow_cache_misses++;
+}
+
+/**
+ * @brief calculate shadow cache rate 함수 - 계산 수행
+ *
+ * @param m 파라미터
+ *
+ * @return double 가려진 광선 중 캐시로 해결된 비율 (%)
+ */
+double	calculate_shadow_cache_rate(t_metrics *m)
+{
+	long	blocked;
+
+	blocked = m->shadow_cache_hits + m->shadow_cache_misses;
+	if (blocked == 0)
+		return (0.0);
+	return (100.0 * m->shadow_cache_hits / blocked);
+}
@@ -15,24 +15,21 @@
 #include "window.h"
 #include "pixel_timing.h"
 #include "metrics.h"
+#include "render_damage.h"
 
-/*
-** Convert screen pixel coordinates to Normalized Device Coordinates.
-** NDC range: u in [-1, 1] (left to right), v in [-1, 1] (bottom to top).
-*/
 /*
 ** Write color directly to image buffer for fast rendering.
 ** Converts RGB color to packed integer and writes to memory.
 */
 /**
- * @brief put pixel to buffer 함수
+ * @brief render put pixel 함수
  *
  * @param render 파라미터
  * @param x 파라미터
  * @param y 파라미터
  * @param color 파라미터
  */
-static void	put_pixel_to_buffer(t_render *render, int x, int y, t_color color)
+void	render_put_pixel(t_render *render, int x, int y, t_color color)
 {
 	int		offset;
 	int		pixel_color;
@@ -45,101 +42,79 @@ static void	put_pixel_to_buffer(t_render *render, int x, int y, t_color color)
 }
 
 /*
-** Render single pixel at screen coordinates (x, y).
-** Converts screen space to normalized device coordinates.
-** Creates camera ray, traces it, and writes resulting color to buffer.
+** Store the primary hit of pixel (x, y): the pick id (in low quality mode
+** the whole 2x2 block shares it, like its color) and, at full quality,
+** the depth used by reprojection. No-op for buffers that are missing.
 */
 /**
- * @brief render pixel 함수 - 렌더링 수행
+ * @brief render store primary 함수
  *
- * @param scene 파라미터
  * @param render 파라미터
  * @param x 파라미터
  * @param y 파라미터
+ * @param primary 픽 ID와 거리
  */
-static void	render_pixel(t_scene *scene, t_render *render, int x, int y)
+void	render_store_primary(t_render *render, int x, int y,
+		t_primary *primary)
 {
-	t_ray	ray;
-	t_color	color;
-	double	u;
-	double	v;
-	long	timing[2];
+	int	*row;
 
-	u = (2.0 * x / (double)WINDOW_WIDTH) - 1.0;
-	v = 1.0 - (2.0 * y / (double)WINDOW_HEIGHT);
-	ray = create_camera_ray(&scene->camera, u, v);
-	timing[0] = get_time_ns();
-	color = trace_ray(scene, &ray);
-	timing[1] = get_time_ns();
-	pixel_timing_add_sample(&render->pixel_timing, timing[1] - timing[0]);
-	put_pixel_to_buffer(render, x, y, color);
-}
-
-/*
-** Draw a 2x2 pixel block with the same color for low quality rendering.
-*/
-/**
- * @brief draw pixel block 함수 - 그리기 수행
- *
- * @param render 파라미터
- * @param x 파라미터
- * @param y 파라미터
- * @param color 파라미터
- */
-static void	draw_pixel_block(t_render *render, int x, int y, t_color color)
-{
-	put_pixel_to_buffer(render, x, y, color);
+	if (render->reproj.depth && !render->low_quality)
+		render->reproj.depth[y * WINDOW_WIDTH + x] = primary->depth;
+	if (!render->pick_ids)
+		return ;
+	row = render->pick_ids + y * WINDOW_WIDTH;
+	row[x] = primary->pick;
+	if (!render->low_quality)
+		return ;
 	if (x + 1 < WINDOW_WIDTH)
-		put_pixel_to_buffer(render, x + 1, y, color);
-	if (y + 1 < WINDOW_HEIGHT)
-	{
-		put_pixel_to_buffer(render, x, y + 1, color);
-		if (x + 1 < WINDOW_WIDTH)
-			put_pixel_to_buffer(render, x + 1, y + 1, color);
-	}
+		row[x + 1] = primary->pick;
+	if (y + 1 >= WINDOW_HEIGHT)
+		return ;
+	row[x + WINDOW_WIDTH] = primary->pick;
+	if (x + 1 < WINDOW_WIDTH)
+		row[x + WINDOW_WIDTH + 1] = primary->pick;
 }
 
 /*
-** Render scene at reduced resolution for fast preview.
-** Uses 2x2 pixel blocks to achieve 4x speedup.
+** Render single pixel at screen coordinates (x, y).
+** Converts screen space to normalized device coordinates.
+** Creates camera ray, traces it, and writes resulting color to buffer.
 */
 /**
- * @brief render low quality 함수 - 렌더링 수행
+ * @brief render pixel 함수 - 렌더링 수행
  *
  * @param scene 파라미터
  * @param render 파라미터
+ * @param x 파라미터
+ * @param y 파라미터
  */
-static void	render_low_quality(t_scene *scene, t_render *render)
+void	render_pixel(t_scene *scene, t_render *render, int x, int y)
 {
-	int		x;
-	int		y;
-	t_ray	ray;
-	t_color	color;
-	double	uv[2];
+	t_ray		ray;
+	t_color		color;
+	t_real		uv[2];
+	long		timing[2];
+	t_primary	primary;
 
-	y = 0;
-	while (y < WINDOW_HEIGHT)
-	{
-		if (render->debounce.cancel_requested)
-			return ;
-		x = 0;
-		while (x < WINDOW_WIDTH)
-		{
-			uv[0] = (2.0 * x / (double)WINDOW_WIDTH) - 1.0;
-			uv[1] = 1.0 - (2.0 * y / (double)WINDOW_HEIGHT);
-			ray = create_camera_ray(&scene->camera, uv[0], uv[1]);
-			color = trace_ray(scene, &ray);
-			draw_pixel_block(render, x, y, color);
-			x += 2;
-		}
-		y += 2;
-	}
+	uv[0] = (2 * x / (t_real)WINDOW_WIDTH) - 1;
+	uv[1] = 1 - (2 * y / (t_real)WINDOW_HEIGHT);
+	ray = create_camera_ray(&scene->camera, uv[0], uv[1]);
+	scene->shadow_table.tile = shadow_tile_index(x, y);
+	timing[0] = get_time_ns();
+	color = trace_ray(scene, &ray, &primary);
+	timing[1] = get_time_ns();
+	pixel_timing_add_sample(&render->pixel_timing, timing[1] - timing[0]);
+	render_put_pixel(render, x, y, color);
+	render_store_primary(render, x, y, &primary);
 }
 
 /*
 ** Render entire scene to image buffer.
 ** Uses low quality mode if requested for faster preview.
-** Otherwise renders at full 800x600 resolution.
+** Only the damaged rectangle is traced when the last changes were
+** object moves covering a small part of the screen.
+** Full quality traces 2x2 ray packets when the wide BVH is in use.
 */
 /**
  * @brief render scene to buffer 함수 - 렌더링 수행
@@ -149,27 +124,20 @@ static void	render_low_quality(t_scene *scene, t_render *render)
  */
 void	render_scene_to_buffer(t_scene *scene, t_render *render)
 {
-	int		x;
-	int		y;
+	t_tile_rect	rect;
 
+	trace_frame_prepare(scene);
+	damage_frame_rect(&render->damage, &rect);
+	scene->render_state.metrics.redraw_percent = (int)(100L * rect.w * rect.h
+			/ ((long)WINDOW_WIDTH * WINDOW_HEIGHT));
 	if (render->low_quality)
 	{
-		render_low_quality(scene, render);
+		render_low_quality(scene, render, &rect);
 		return ;
 	}
-	y = 0;
-	while (y < WINDOW_HEIGHT)
-	{
-		if (render->debounce.cancel_requested)
-			return ;
-		x = 0;
-		while (x < WINDOW_WIDTH)
-		{
-			render_pixel(scene, render, x, y);
-			x++;
-		}
-		y++;
-	}
+	render_full_quality(scene, render, &rect);
+	if (render->debounce.cancel_requested)
+		return ;
 	pixel_timing_calculate_stats(&render->pixel_timing);
 	pixel_timing_print_stats(&render->pixel_timing);
 }
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_damage.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/27 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/27 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render_damage.h"
+#include "window.h"
+
+/*
+** Forget all damage (after a complete full-quality frame).
+*/
+void	damage_reset(t_damage *damage)
+{
+	damage->full = 0;
+	damage->x0 = 0;
+	damage->y0 = 0;
+	damage->x1 = 0;
+	damage->y1 = 0;
+}
+
+/*
+** Require a full frame (camera or light changed, first frame).
+*/
+void	damage_mark_full(t_damage *damage)
+{
+	damage->full = 1;
+}
+
+/*
+** Grow the damaged rectangle to include rect.
+*/
+static void	damage_add_rect(t_damage *damage, t_tile_rect *rect)
+{
+	if (rect->w <= 0 || rect->h <= 0)
+		return ;
+	if (damage->x0 >= damage->x1)
+	{
+		damage->x0 = rect->x;
+		damage->y0 = rect->y;
+		damage->x1 = rect->x + rect->w;
+		damage->y1 = rect->y + rect->h;
+		return ;
+	}
+	if (rect->x < damage->x0)
+		damage->x0 = rect->x;
+	if (rect->y < damage->y0)
+		damage->y0 = rect->y;
+	if (rect->x + rect->w > damage->x1)
+		damage->x1 = rect->x + rect->w;
+	if (rect->y + rect->h > damage->y1)
+		damage->y1 = rect->y + rect->h;
+}
+
+/**
+ * @brief damage add object 함수 - 객체와 그림자 영역을 손상 영역에 추가
+ *
+ * @param damage 파라미터
+ * @param scene 파라미터
+ * @param ref 이동한 객체
+ */
+void	damage_add_object(t_damage *damage, t_scene *scene, t_object_ref ref)
+{
+	t_tile_rect	rect;
+
+	if (damage->full)
+		return ;
+	if ((ref.type != OBJ_SPHERE && ref.type != OBJ_CYLINDER)
+		|| !damage_project_object(scene, get_object_bounds(ref, scene),
+			&rect))
+	{
+		damage_mark_full(damage);
+		return ;
+	}
+	damage_add_rect(damage, &rect);
+}
+
+/**
+ * @brief damage frame rect 함수 - 다음 프레임에서 추적할 영역
+ *
+ * 2x2 미리보기 블록이 영역 밖을 덮지 않도록 짝수 격자에 맞춘다.
+ *
+ * @param damage 파라미터
+ * @param rect 출력 영역
+ *
+ * @return int 부분 렌더링이면 1, 전체 프레임이면 0
+ */
+int	damage_frame_rect(t_damage *damage, t_tile_rect *rect)
+{
+	long	area;
+
+	rect->x = 0;
+	rect->y = 0;
+	rect->w = WINDOW_WIDTH;
+	rect->h = WINDOW_HEIGHT;
+	area = (long)(damage->x1 - damage->x0) * (damage->y1 - damage->y0);
+	if (damage->full || damage->x0 >= damage->x1
+		|| area > DAMAGE_MAX_RATIO * WINDOW_WIDTH * WINDOW_HEIGHT)
+		return (0);
+	rect->x = damage->x0 & ~1;
+	rect->y = damage->y0 & ~1;
+	rect->w = ((damage->x1 + 1) & ~1) - rect->x;
+	rect->h = ((damage->y1 + 1) & ~1) - rect->y;
+	return (1);
+}
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_damage_project.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/27 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/27 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render_damage.h"
+#include "window.h"
+#include <tgmath.h>
+
+/*
+** Project a world point to pixel coordinates and grow the view bounds.
+** Returns 0 for points at or behind the camera plane.
+*/
+static int	project_point(t_damage_view *view, t_vec3 p)
+{
+	t_real	px[2];
+
+	if (!camera_project(view->camera, &view->calc, p, px))
+		return (0);
+	view->min[0] = fmin(view->min[0], px[0]);
+	view->min[1] = fmin(view->min[1], px[1]);
+	view->max[0] = fmax(view->max[0], px[0]);
+	view->max[1] = fmax(view->max[1], px[1]);
+	return (1);
+}
+
+/*
+** The 8 corners of an AABB.
+*/
+static void	box_corners(t_aabb box, t_vec3 *c)
+{
+	t_vec3	e[2];
+	int		i;
+
+	e[0] = box.min;
+	e[1] = box.max;
+	i = 0;
+	while (i < 8)
+	{
+		c[i] = (t_vec3){e[i & 1].x, e[(i >> 1) & 1].y, e[(i >> 2) & 1].z};
+		i++;
+	}
+}
+
+/*
+** Project the box corners and the far end of every corner-to-light
+** shadow ray; their convex hull contains object and shadow volume.
+*/
+static int	project_volume(t_damage_view *view, t_vec3 *c, t_vec3 *l,
+		t_real reach)
+{
+	int		k;
+	t_vec3	end;
+
+	k = 0;
+	while (k < 8)
+	{
+		if (!project_point(view, c[k]))
+			return (0);
+		k++;
+	}
+	k = 0;
+	while (k < 32)
+	{
+		end = vec3_add(c[k / 4], vec3_multiply(
+					vec3_subtract(c[k / 4], l[k % 4]), reach));
+		if (!project_point(view, end))
+			return (0);
+		k++;
+	}
+	return (1);
+}
+
+/*
+** Pixel rectangle of the view bounds plus margin, clipped to the screen
+** (empty when the volume is off-screen).
+*/
+static void	view_to_rect(t_damage_view *view, t_tile_rect *rect)
+{
+	t_real	x0;
+	t_real	y0;
+	t_real	x1;
+	t_real	y1;
+
+	x0 = fmax(floor(view->min[0]) - DAMAGE_MARGIN, (t_real)0);
+	y0 = fmax(floor(view->min[1]) - DAMAGE_MARGIN, (t_real)0);
+	x1 = fmin(ceil(view->max[0]) + DAMAGE_MARGIN + 1, (t_real)WINDOW_WIDTH);
+	y1 = fmin(ceil(view->max[1]) + DAMAGE_MARGIN + 1, (t_real)WINDOW_HEIGHT);
+	rect->x = (int)x0;
+	rect->y = (int)y0;
+	rect->w = (int)fmax(x1 - x0, (t_real)0);
+	rect->h = (int)fmax(y1 - y0, (t_real)0);
+}
+
+/**
+ * @brief damage project object 함수 - 객체와 그림자 볼륨의 화면 영역
+ *
+ * @param scene 파라미터
+ * @param box 객체 AABB
+ * @param rect 출력 영역
+ *
+ * @return int 성공 1, 화면 영역을 제한할 수 없으면 0
+ */
+int	damage_project_object(t_scene *scene, t_aabb box, t_tile_rect *rect)
+{
+	t_damage_view	view;
+	t_vec3			c[8];
+	t_vec3			l[4];
+	t_real			reach;
+
+	box_corners(box, c);
+	damage_light_corners(scene, l);
+	reach = damage_shadow_reach(scene, box, c, l);
+	if (reach < 0)
+		return (0);
+	view.camera = &scene->camera;
+	camera_calc_init(&scene->camera, &view.calc);
+	view.min[0] = INFINITY;
+	view.min[1] = INFINITY;
+	view.max[0] = -INFINITY;
+	view.max[1] = -INFINITY;
+	if (!project_volume(&view, c, l, reach))
+		return (0);
+	view_to_rect(&view, rect);
+	return (1);
+}
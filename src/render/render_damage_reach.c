@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_damage_reach.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/27 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/27 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render_damage.h"
+#include "window.h"
+#include <tgmath.h>
+
+/*
+** Shadow rays start on the light disk used by the soft-shadow sampler:
+** position + table offset (x, y within softness * 2, z = 0).
+*/
+void	damage_light_corners(t_scene *scene, t_vec3 *corners)
+{
+	t_real	r;
+
+	r = 0.0;
+	if (scene->shadow_config.samples > 1)
+		r = scene->shadow_config.softness * 2;
+	corners[0] = vec3_add(scene->light.position, (t_vec3){-r, -r, 0.0});
+	corners[1] = vec3_add(scene->light.position, (t_vec3){r, -r, 0.0});
+	corners[2] = vec3_add(scene->light.position, (t_vec3){-r, r, 0.0});
+	corners[3] = vec3_add(scene->light.position, (t_vec3){r, r, 0.0});
+}
+
+/*
+** Smallest distance between the light area and the object box.
+*/
+static t_real	light_gap(t_aabb box, t_vec3 *l)
+{
+	t_vec3	lmin;
+	t_vec3	lmax;
+	t_vec3	gap;
+
+	lmin = l[0];
+	lmax = l[3];
+	gap.x = fmax((t_real)0, fmax(lmin.x - box.max.x, box.min.x - lmax.x));
+	gap.y = fmax((t_real)0, fmax(lmin.y - box.max.y, box.min.y - lmax.y));
+	gap.z = fmax((t_real)0, fmax(lmin.z - box.max.z, box.min.z - lmax.z));
+	return (vec3_magnitude(gap));
+}
+
+/*
+** Diagonal of the bounds of every finite object, instance and mesh (and
+** of box). Planes are infinite and skipped.
+*/
+static t_real	finite_extent(t_scene *scene, t_aabb box)
+{
+	int	count[OBJ_MESH + 1];
+	int	type;
+	int	i;
+
+	count[OBJ_SPHERE] = scene->sphere_count;
+	count[OBJ_PLANE] = 0;
+	count[OBJ_CYLINDER] = scene->cylinder_count;
+	count[OBJ_INSTANCE] = scene->instance_count;
+	count[OBJ_MESH] = scene->mesh_count;
+	type = OBJ_SPHERE;
+	while (type <= OBJ_MESH)
+	{
+		i = 0;
+		while (i < count[type])
+		{
+			box = aabb_merge(box, get_object_bounds(
+						(t_object_ref){type, i}, scene));
+			i++;
+		}
+		type++;
+	}
+	return (vec3_magnitude(vec3_subtract(box.max, box.min)));
+}
+
+/*
+** Largest t at which a shadow ray c + t * (c - l) crosses the plane.
+** If the rays do not all head to the same side of the plane, the shadow
+** on it is unbounded: -1.
+*/
+static t_real	plane_reach(t_plane *plane, t_vec3 *c, t_vec3 *l)
+{
+	t_real	reach;
+	t_real	f;
+	t_real	g;
+	int		k;
+	int		side;
+
+	reach = 0.0;
+	side = 0;
+	k = 0;
+	while (k < 32)
+	{
+		f = vec3_dot(plane->normal, vec3_subtract(c[k / 4], plane->point));
+		g = vec3_dot(plane->normal, vec3_subtract(c[k / 4], l[k % 4]));
+		if (fabs(g) < EPSILON || (side != 0 && (g > 0) != (side > 0)))
+			return (-1.0);
+		side = 1 - 2 * (g < 0);
+		if (f * g < 0 && -f / g > reach)
+			reach = -f / g;
+		k++;
+	}
+	return (reach);
+}
+
+/**
+ * @brief damage shadow reach 함수 - 그림자 광선의 최대 도달 거리
+ *
+ * 유한 객체는 장면 크기 / 광원 거리 이내, 평면은 교차점까지만
+ * 그림자를 받는다. 광선 끝점의 볼록 껍질이 그림자 볼륨을 덮는다.
+ *
+ * @param scene 파라미터
+ * @param box 객체 AABB
+ * @param c 객체 AABB 꼭짓점 8개
+ * @param l 광원 영역 꼭짓점 4개
+ *
+ * @return t_real 최대 t, 제한할 수 없으면 -1
+ */
+t_real	damage_shadow_reach(t_scene *scene, t_aabb box, t_vec3 *c,
+		t_vec3 *l)
+{
+	t_real	reach;
+	t_real	plane;
+	t_real	gap;
+	int		i;
+
+	gap = light_gap(box, l);
+	if (gap < EPSILON)
+		return (-1.0);
+	reach = finite_extent(scene, box) / gap;
+	i = 0;
+	while (i < scene->plane_count)
+	{
+		plane = plane_reach(&scene->planes[i], c, l);
+		if (plane < 0)
+			return (-1.0);
+		if (plane > reach)
+			reach = plane;
+		i++;
+	}
+	return (reach);
+}
@@ -55,17 +55,19 @@ void	debounce_on_input(t_debounce_state *state, t_render *render)
 /*
 ** debounce_update - Update state machine on each frame
 ** Checks timer expiration and transitions between states
+** A reprojected frame on screen is already a sharp preview, so the 2x2
+** pass is skipped and the full-quality refinement runs directly
 */
 void	debounce_update(t_debounce_state *state, t_render *render)
 {
 	if (state->state == DEBOUNCE_ACTIVE
 		&& debounce_timer_expired(&state->timer))
 	{
-		if (state->preview_enabled)
+		if (state->preview_enabled && !render->reproj.pending)
 			state->state = DEBOUNCE_PREVIEW;
 		else
 			state->state = DEBOUNCE_FINAL;
-		render->low_quality = state->preview_enabled;
+		render->low_quality = (state->state == DEBOUNCE_PREVIEW);
 		render->dirty = 1;
 		debounce_timer_stop(&state->timer);
 	}
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_packet.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/02 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/02 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "ray.h"
+#include "window.h"
+#include "pixel_timing.h"
+#include "metrics.h"
+
+/*
+** Trace the 2x2 block at (x, y) as one packet, then shade and store
+** every pixel. The traversal time is shared evenly by the four pixels.
+*/
+/**
+ * @brief render block 함수 - 렌더링 수행
+ *
+ * @param scene 파라미터
+ * @param render 파라미터
+ * @param x 블록 왼쪽 위 픽셀 x
+ * @param y 블록 왼쪽 위 픽셀 y
+ */
+static void	render_block(t_scene *scene, t_render *render, int x, int y)
+{
+	t_ray_packet	packet;
+	t_primary		primary;
+	t_color			color;
+	long			timing[2];
+	int				lane;
+
+	timing[0] = get_time_ns();
+	trace_packet(scene, &packet, x, y);
+	timing[1] = (get_time_ns() - timing[0]) / PACKET_LANES;
+	lane = 0;
+	while (lane < PACKET_LANES)
+	{
+		timing[0] = get_time_ns();
+		scene->shadow_table.tile = shadow_tile_index(x + lane % 2,
+				y + lane / 2);
+		color = trace_shade(scene, (packet.found >> lane) & 1,
+				&packet.hit[lane], &primary);
+		pixel_timing_add_sample(&render->pixel_timing,
+			get_time_ns() - timing[0] + timing[1]);
+		render_put_pixel(render, x + lane % 2, y + lane / 2, color);
+		render_store_primary(render, x + lane % 2, y + lane / 2, &primary);
+		lane++;
+	}
+}
+
+/*
+** Packet pass: the rectangle is on the 2x2 block grid
+** (damage_frame_rect) and the window size is even, so every block is
+** complete.
+*/
+static void	render_blocks(t_scene *scene, t_render *render, t_tile_rect *rect)
+{
+	int	x;
+	int	y;
+
+	y = rect->y;
+	while (y < rect->y + rect->h)
+	{
+		if (render->debounce.cancel_requested)
+			return ;
+		x = rect->x;
+		while (x < rect->x + rect->w)
+		{
+			render_block(scene, render, x, y);
+			x += 2;
+		}
+		y += 2;
+	}
+}
+
+/*
+** Single-ray pass, one pixel at a time.
+*/
+static void	render_rows(t_scene *scene, t_render *render, t_tile_rect *rect)
+{
+	int	x;
+	int	y;
+
+	y = rect->y;
+	while (y < rect->y + rect->h)
+	{
+		if (render->debounce.cancel_requested)
+			return ;
+		x = rect->x;
+		while (x < rect->x + rect->w)
+			render_pixel(scene, render, x++, y);
+		y++;
+	}
+}
+
+/**
+ * @brief render full quality 함수 - 렌더링 수행
+ *
+ * 넓은 BVH를 쓰는 동안 타일 절두체 컬링 후 2x2 픽셀 블록을 광선
+ * 묶음으로 추적하고, 그렇지 않으면 픽셀마다 광선 하나를 추적한다.
+ *
+ * @param scene 파라미터
+ * @param render 파라미터
+ * @param rect 렌더링할 화면 영역
+ */
+void	render_full_quality(t_scene *scene, t_render *render, t_tile_rect *rect)
+{
+	if (trace_packet_enabled(scene))
+	{
+		tile_cull_update(scene, rect);
+		render_blocks(scene, render, rect);
+	}
+	else
+		render_rows(scene, render, rect);
+}
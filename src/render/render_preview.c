@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_preview.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/26 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/26 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "ray.h"
+#include "window.h"
+
+/*
+** Draw a 2x2 pixel block with the same color for low quality rendering.
+*/
+/**
+ * @brief draw pixel block 함수 - 그리기 수행
+ *
+ * @param render 파라미터
+ * @param x 파라미터
+ * @param y 파라미터
+ * @param color 파라미터
+ */
+static void	draw_pixel_block(t_render *render, int x, int y, t_color color)
+{
+	render_put_pixel(render, x, y, color);
+	if (x + 1 < WINDOW_WIDTH)
+		render_put_pixel(render, x + 1, y, color);
+	if (y + 1 < WINDOW_HEIGHT)
+	{
+		render_put_pixel(render, x, y + 1, color);
+		if (x + 1 < WINDOW_WIDTH)
+			render_put_pixel(render, x + 1, y + 1, color);
+	}
+}
+
+/*
+** Trace the ray of block (x, y) and fill its 2x2 color and pick ids.
+*/
+/**
+ * @brief render preview block 함수 - 렌더링 수행
+ *
+ * @param scene 파라미터
+ * @param render 파라미터
+ * @param x 파라미터
+ * @param y 파라미터
+ */
+static void	render_preview_block(t_scene *scene, t_render *render, int x,
+		int y)
+{
+	t_ray		ray;
+	t_color		color;
+	t_real		uv[2];
+	t_primary	primary;
+
+	uv[0] = (2 * x / (t_real)WINDOW_WIDTH) - 1;
+	uv[1] = 1 - (2 * y / (t_real)WINDOW_HEIGHT);
+	ray = create_camera_ray(&scene->camera, uv[0], uv[1]);
+	scene->shadow_table.tile = shadow_tile_index(x, y);
+	color = trace_ray(scene, &ray, &primary);
+	draw_pixel_block(render, x, y, color);
+	render_store_primary(render, x, y, &primary);
+}
+
+/*
+** Render scene at reduced resolution for fast preview.
+** Uses 2x2 pixel blocks to achieve 4x speedup. The rectangle is on the
+** block grid (damage_frame_rect), so partial previews stay inside it.
+*/
+/**
+ * @brief render low quality 함수 - 렌더링 수행
+ *
+ * @param scene 파라미터
+ * @param render 파라미터
+ * @param rect 렌더링할 화면 영역
+ */
+void	render_low_quality(t_scene *scene, t_render *render, t_tile_rect *rect)
+{
+	int	x;
+	int	y;
+
+	y = rect->y;
+	while (y < rect->y + rect->h)
+	{
+		if (render->debounce.cancel_requested)
+			return ;
+		x = rect->x;
+		while (x < rect->x + rect->w)
+		{
+			render_preview_block(scene, render, x, y);
+			x += 2;
+		}
+		y += 2;
+	}
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_reproject.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/28 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/28 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render_reproject.h"
+#include "window.h"
+#include "metrics.h"
+#include <stdlib.h>
+
+/**
+ * @brief reproject free 함수 - 정리 수행
+ *
+ * @param reproj 파라미터
+ */
+void	reproject_free(t_reproject *reproj)
+{
+	free(reproj->depth);
+	free(reproj->next_depth);
+	free(reproj->next_color);
+	free(reproj->next_pick);
+	reproj->depth = NULL;
+	reproj->next_depth = NULL;
+	reproj->next_color = NULL;
+	reproj->next_pick = NULL;
+	reproj->valid = 0;
+}
+
+/**
+ * @brief reproject init 함수 - 초기화 수행
+ *
+ * 버퍼 하나라도 할당에 실패하면 모두 해제하고 재투영을 끈다.
+ *
+ * @param reproj 파라미터
+ */
+void	reproject_init(t_reproject *reproj)
+{
+	size_t	count;
+
+	count = (size_t)WINDOW_WIDTH * WINDOW_HEIGHT;
+	reproj->depth = malloc(sizeof(float) * count);
+	reproj->next_depth = malloc(sizeof(float) * count);
+	reproj->next_color = malloc(sizeof(unsigned int) * count);
+	reproj->next_pick = malloc(sizeof(int) * count);
+	reproj->valid = 0;
+	reproj->pending = 0;
+	if (!reproj->depth || !reproj->next_depth || !reproj->next_color
+		|| !reproj->next_pick)
+		reproject_free(reproj);
+}
+
+/**
+ * @brief reproject frame done 함수 - 프레임 완료 처리
+ *
+ * @param reproj 파라미터
+ * @param camera 프레임을 렌더링한 카메라
+ * @param complete 취소되지 않고 끝났으면 1
+ * @param low_quality 2x2 미리보기 프레임이면 1 (깊이 없음)
+ */
+void	reproject_frame_done(t_reproject *reproj, t_camera *camera,
+		int complete, int low_quality)
+{
+	reproj->camera = *camera;
+	reproj->valid = complete && !low_quality;
+	if (complete)
+		reproj->pending = 0;
+}
+
+/**
+ * @brief reproject frame 함수 - 카메라 이동 직후 재투영 프레임 생성
+ *
+ * 렌더링 시간과 다시 추적한 화면 비율은 프레임 메트릭에 기록되어
+ * HUD에 표시된다. 디바운스가 끝나면 전체 프레임이 이를 대체한다.
+ *
+ * @param render 파라미터
+ */
+void	reproject_frame(t_render *render)
+{
+	t_metrics		*m;
+	struct timeval	start;
+	int				traced;
+
+	if (!render->reproj.depth || !render->pick_ids || !render->reproj.valid)
+		return ;
+	m = &render->scene->render_state.metrics;
+	timer_start(&start);
+	trace_frame_prepare(render->scene);
+	reproject_warp(render);
+	traced = reproject_fill_holes(render);
+	render->reproj.camera = render->scene->camera;
+	render->reproj.pending = 1;
+	render->view_valid = 0;
+	m->render_time_us = timer_elapsed_us(&start);
+	m->redraw_percent = (int)(100L * traced
+			/ ((long)WINDOW_WIDTH * WINDOW_HEIGHT));
+}
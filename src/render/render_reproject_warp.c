@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_reproject_warp.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/28 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/28 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "render_reproject.h"
+#include "window.h"
+#include "utils.h"
+#include <math.h>
+
+/*
+** Move source pixel (x, y), which has a hit, to the pixel its hit point
+** projects to in the new view; the nearest surface wins (z-buffer on
+** next_depth).
+*/
+static void	warp_pixel(t_render *render, t_warp *w, int x, int y)
+{
+	t_vec3	p;
+	t_real	uv[2];
+	t_real	px[2];
+	t_real	depth;
+	int		n;
+
+	depth = render->reproj.depth[y * WINDOW_WIDTH + x];
+	uv[0] = (2 * x / (t_real)WINDOW_WIDTH) - 1;
+	uv[1] = 1 - (2 * y / (t_real)WINDOW_HEIGHT);
+	p = vec3_add(w->src->position, vec3_multiply(
+				camera_ray_direction(w->src, &w->src_calc, uv[0], uv[1]),
+				depth));
+	if (!camera_project(w->dst, &w->dst_calc, p, px)
+		|| px[0] < -(t_real)0.5 || px[0] >= WINDOW_WIDTH - (t_real)0.5
+		|| px[1] < -(t_real)0.5 || px[1] >= WINDOW_HEIGHT - (t_real)0.5)
+		return ;
+	n = (int)(px[1] + (t_real)0.5) * WINDOW_WIDTH
+		+ (int)(px[0] + (t_real)0.5);
+	depth = vec3_magnitude(vec3_subtract(p, w->dst->position));
+	if (render->reproj.next_depth[n] >= 0
+		&& render->reproj.next_depth[n] <= depth)
+		return ;
+	render->reproj.next_depth[n] = depth;
+	render->reproj.next_color[n] = ((unsigned int *)render->img_data)[y
+		* (render->size_line / 4) + x];
+	render->reproj.next_pick[n] = render->pick_ids[y * WINDOW_WIDTH + x];
+}
+
+/*
+** Make the warp targets the current buffers and copy the warped colors
+** into the scene image.
+*/
+static void	warp_swap(t_render *render)
+{
+	t_reproject	*rp;
+	float		*depth;
+	int			*pick;
+	int			y;
+
+	rp = &render->reproj;
+	depth = rp->depth;
+	rp->depth = rp->next_depth;
+	rp->next_depth = depth;
+	pick = render->pick_ids;
+	render->pick_ids = rp->next_pick;
+	rp->next_pick = pick;
+	y = 0;
+	while (y < WINDOW_HEIGHT)
+	{
+		ft_memcpy(render->img_data + y * render->size_line,
+			rp->next_color + y * WINDOW_WIDTH,
+			sizeof(unsigned int) * WINDOW_WIDTH);
+		y++;
+	}
+}
+
+/**
+ * @brief reproject warp 함수 - 이전 프레임을 현재 카메라로 변환
+ *
+ * 깊이로 복원한 월드 좌표를 새 카메라로 투영한다 (forward warp).
+ * 아무 픽셀도 도착하지 않은 곳은 깊이가 -1로 남는다.
+ *
+ * @param render 파라미터
+ */
+void	reproject_warp(t_render *render)
+{
+	t_warp	w;
+	int		x;
+	int		y;
+
+	w.src = &render->reproj.camera;
+	w.dst = &render->scene->camera;
+	camera_calc_init(w.src, &w.src_calc);
+	camera_calc_init(w.dst, &w.dst_calc);
+	x = 0;
+	while (x < WINDOW_WIDTH * WINDOW_HEIGHT)
+		render->reproj.next_depth[x++] = -1.0f;
+	y = 0;
+	while (y < WINDOW_HEIGHT)
+	{
+		x = 0;
+		while (x < WINDOW_WIDTH)
+		{
+			if (render->reproj.depth[y * WINDOW_WIDTH + x] >= 0)
+				warp_pixel(render, &w, x, y);
+			x++;
+		}
+		y++;
+	}
+	warp_swap(render);
+}
+
+/**
+ * @brief reproject fill holes 함수 - 빈 픽셀만 다시 추적
+ *
+ * 가려졌다 드러난 영역, 화면 밖에서 들어온 영역, 배경(미스) 픽셀이
+ * 대상이다. 미리보기 상태여도 전체 품질로 추적한다.
+ *
+ * @param render 파라미터
+ *
+ * @return int 추적한 픽셀 수
+ */
+int	reproject_fill_holes(t_render *render)
+{
+	int	low_quality;
+	int	traced;
+	int	x;
+	int	y;
+
+	low_quality = render->low_quality;
+	render->low_quality = 0;
+	traced = 0;
+	y = 0;
+	while (y < WINDOW_HEIGHT)
+	{
+		x = 0;
+		while (x < WINDOW_WIDTH)
+		{
+			if (render->reproj.depth[y * WINDOW_WIDTH + x] < 0)
+			{
+				render_pixel(render->scene, render, x, y);
+				traced++;
+			}
+			x++;
+		}
+		y++;
+	}
+	render->low_quality = low_quality;
+	return (traced);
+}
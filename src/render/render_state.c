@@ -36,6 +36,10 @@ void	render_state_init(t_render_state *state)
 	state->adaptive_enabled = 0;
 	state->bvh_enabled = 1;
 	state->show_info = 1;
+	state->edit_generation = 0;
+	state->tiles.roots = NULL;
+	state->tiles.cols = 0;
+	state->tiles.rows = 0;
 }
 
 /**
@@ -50,6 +54,8 @@ void	render_state_cleanup(t_render_state *state)
 		bvh_destroy(state->bvh);
 		state->bvh = NULL;
 	}
+	free(state->tiles.roots);
+	state->tiles.roots = NULL;
 }
 
 /**
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_tile_cull.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/03 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/03 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "window.h"
+#include "spatial.h"
+#include <stdlib.h>
+
+/*
+** Direction of the primary ray through pixel position (x, y), with the
+** same NDC mapping as render_pixel().
+*/
+static t_vec3	pixel_dir(t_camera *camera, t_cam_calc *calc, t_real x,
+		t_real y)
+{
+	return (camera_ray_direction(camera, calc,
+			(2 * x / (t_real)WINDOW_WIDTH) - 1,
+			1 - (2 * y / (t_real)WINDOW_HEIGHT)));
+}
+
+/*
+** Frustum of a tile: the corner rays half a pixel outside the tile, in
+** order around it, and side normals turned toward the tile center. The
+** half pixel keeps rounding in the normals from culling a box that an
+** edge ray grazes.
+*/
+static void	tile_frustum(t_camera *camera, t_cam_calc *calc,
+		t_tile_rect *tile, t_frustum *f)
+{
+	t_vec3	d[4];
+	t_vec3	center;
+	int		k;
+
+	d[0] = pixel_dir(camera, calc, tile->x - 0.5, tile->y - 0.5);
+	d[1] = pixel_dir(camera, calc, tile->x + tile->w - 0.5, tile->y - 0.5);
+	d[2] = pixel_dir(camera, calc, tile->x + tile->w - 0.5,
+			tile->y + tile->h - 0.5);
+	d[3] = pixel_dir(camera, calc, tile->x - 0.5, tile->y + tile->h - 0.5);
+	center = vec3_add(vec3_add(d[0], d[1]), vec3_add(d[2], d[3]));
+	f->origin = camera->position;
+	k = 0;
+	while (k < 4)
+	{
+		f->normal[k] = vec3_normalize(vec3_cross(d[k], d[(k + 1) % 4]));
+		if (vec3_dot(f->normal[k], center) < 0)
+			f->normal[k] = vec3_multiply(f->normal[k], -1.0);
+		k++;
+	}
+}
+
+/*
+** Cull the BVH against tile (col, row), clipped to the window.
+*/
+static void	build_tile(t_scene *scene, t_cam_calc *calc, int col, int row)
+{
+	t_tile_cull	*tiles;
+	t_tile_rect	tile;
+	t_frustum	f;
+
+	tiles = &scene->render_state.tiles;
+	tile.x = col * TILE_CULL_SIZE;
+	tile.y = row * TILE_CULL_SIZE;
+	tile.w = TILE_CULL_SIZE;
+	if (tile.x + tile.w > WINDOW_WIDTH)
+		tile.w = WINDOW_WIDTH - tile.x;
+	tile.h = TILE_CULL_SIZE;
+	if (tile.y + tile.h > WINDOW_HEIGHT)
+		tile.h = WINDOW_HEIGHT - tile.y;
+	tile_frustum(&scene->camera, calc, &tile, &f);
+	bvh_tile_root(scene->render_state.bvh, &f,
+		&tiles->roots[row * tiles->cols + col]);
+}
+
+/*
+** Allocate the tile roots on first use. Returns 0 if out of memory
+** (packets then start at the BVH root).
+*/
+static int	tiles_alloc(t_tile_cull *tiles)
+{
+	if (tiles->roots)
+		return (1);
+	tiles->cols = (WINDOW_WIDTH + TILE_CULL_SIZE - 1) / TILE_CULL_SIZE;
+	tiles->rows = (WINDOW_HEIGHT + TILE_CULL_SIZE - 1) / TILE_CULL_SIZE;
+	tiles->roots = malloc(sizeof(t_bvh_wide) * tiles->cols * tiles->rows);
+	return (tiles->roots != NULL);
+}
+
+/**
+ * @brief tile cull update 함수 - 타일별 절두체 컬링 사전 단계
+ *
+ * 화면 영역에 걸친 타일마다 BVH를 타일 절두체로 컬링해 시작 노드를
+ * 만든다. 카메라와 BVH가 프레임마다 바뀔 수 있으므로 패킷 추적 직전에
+ * 다시 만든다.
+ *
+ * @param scene 넓은 BVH를 쓰는 장면
+ * @param rect 이번 프레임에 추적할 화면 영역
+ */
+void	tile_cull_update(t_scene *scene, t_tile_rect *rect)
+{
+	t_cam_calc	calc;
+	int			col;
+	int			row;
+
+	if (!tiles_alloc(&scene->render_state.tiles))
+		return ;
+	camera_calc_init(&scene->camera, &calc);
+	row = rect->y / TILE_CULL_SIZE;
+	while (row * TILE_CULL_SIZE < rect->y + rect->h)
+	{
+		col = rect->x / TILE_CULL_SIZE;
+		while (col * TILE_CULL_SIZE < rect->x + rect->w)
+		{
+			build_tile(scene, &calc, col, row);
+			col++;
+		}
+		row++;
+	}
+}
@@ -14,12 +14,14 @@
 #include "ray.h"
 #include "spatial.h"
 #include "metrics.h"
+#include "window.h"
 #include <math.h>
 
 /*
 ** Generic intersection checking for object arrays.
-** Iterates through object array and updates hit with closest intersection.
-** Returns 1 if any intersection found, 0 otherwise.
+** Iterates through object array and updates hit with closest intersection;
+** intersect_scene_object() picks the camera-origin kernels for primary
+** rays. Returns 1 if any intersection found, 0 otherwise.
 */
 /**
  * @brief check intersections generic 함수 - 확인 수행
@@ -33,18 +35,17 @@ static int	check_intersections_generic(t_intersect_params *params)
 	t_hit	temp_hit;
 	int		i;
 	int		hit_found;
-	void	*current_obj;
 
-	if (params->objects == NULL && params->count > 0)
-		return (0);
 	hit_found = 0;
 	i = 0;
 	while (i < params->count)
 	{
-		current_obj = (char *)params->objects + (i * params->obj_size);
 		temp_hit.distance = params->hit->distance;
-		if (params->intersect_fn(params->ray, current_obj, &temp_hit))
+		if (intersect_scene_object(params->scene,
+				(t_object_ref){params->obj_type, i}, params->ray, &temp_hit))
 		{
+			temp_hit.obj_type = params->obj_type;
+			temp_hit.obj_index = i;
 			*params->hit = temp_hit;
 			hit_found = 1;
 		}
@@ -71,10 +72,9 @@ int	check_sphere_intersections(t_scene *scene, t_ray *ray, t_hit *hit)
 {
 	t_intersect_params	params;
 
-	params.objects = scene->spheres;
+	params.scene = scene;
 	params.count = scene->sphere_count;
-	params.obj_size = sizeof(t_sphere);
-	params.intersect_fn = (t_intersect_fn)intersect_sphere;
+	params.obj_type = OBJ_SPHERE;
 	params.ray = ray;
 	params.hit = hit;
 	return (check_intersections_generic(&params));
@@ -98,10 +98,9 @@ int	check_plane_intersections(t_scene *scene, t_ray *ray, t_hit *hit)
 {
 	t_intersect_params	params;
 
-	params.objects = scene->planes;
+	params.scene = scene;
 	params.count = scene->plane_count;
-	params.obj_size = sizeof(t_plane);
-	params.intersect_fn = (t_intersect_fn)intersect_plane;
+	params.obj_type = OBJ_PLANE;
 	params.ray = ray;
 	params.hit = hit;
 	return (check_intersections_generic(&params));
@@ -125,10 +124,9 @@ int	check_cylinder_intersections(t_scene *scene, t_ray *ray, t_hit *hit)
 {
 	t_intersect_params	params;
 
-	params.objects = scene->cylinders;
+	params.scene = scene;
 	params.count = scene->cylinder_count;
-	params.obj_size = sizeof(t_cylinder);
-	params.intersect_fn = (t_intersect_fn)intersect_cylinder;
+	params.obj_type = OBJ_CYLINDER;
 	params.ray = ray;
 	params.hit = hit;
 	return (check_intersections_generic(&params));
@@ -138,30 +136,28 @@ int	check_cylinder_intersections(t_scene *scene, t_ray *ray, t_hit *hit)
 ** Trace ray through scene and determine pixel color.
 ** Tests intersection with all objects and finds closest hit.
 ** Uses BVH acceleration if enabled, otherwise brute force.
-** Returns lit color if object hit, black if no intersection.
+** Returns lit color if object hit, black if no intersection
+** (trace_shade).
 */
 /**
  * @brief trace ray 함수
  *
  * @param scene 파라미터
  * @param ray 파라미터
+ * @param primary 픽 ID와 거리 출력 (NULL 가능)
  *
  * @return t_color 반환값
  */
-t_color	trace_ray(t_scene *scene, t_ray *ray)
+t_color	trace_ray(t_scene *scene, t_ray *ray, t_primary *primary)
 {
 	t_hit	hit;
 	int		hit_found;
 
-	metrics_add_ray(&scene->render_state.metrics);
 	hit_found = 0;
 	hit.distance = INFINITY;
 	if (scene->render_state.bvh && scene->render_state.bvh->enabled)
-	{
-		if (bvh_intersect(scene->render_state.bvh, *ray, &hit, scene))
-			hit_found = 1;
-	}
-	if (!hit_found)
+		hit_found = bvh_intersect(scene->render_state.bvh, *ray, &hit, scene);
+	else
 	{
 		if (check_sphere_intersections(scene, ray, &hit))
 			hit_found = 1;
@@ -169,8 +165,10 @@ t_color	trace_ray(t_scene *scene, t_ray *ray)
 			hit_found = 1;
 		if (check_cylinder_intersections(scene, ray, &hit))
 			hit_found = 1;
+		if (check_instance_intersections(scene, ray, &hit))
+			hit_found = 1;
+		if (check_mesh_intersections(scene, ray, &hit))
+			hit_found = 1;
 	}
-	if (hit_found)
-		return (apply_lighting(scene, &hit));
-	return ((t_color){0, 0, 0});
+	return (trace_shade(scene, hit_found, &hit, primary));
 }
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_packet.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/02 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/02 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "ray.h"
+#include "spatial.h"
+#include "metrics.h"
+#include "window.h"
+#include <math.h>
+
+/*
+** Count the ray and shade its closest hit.
+** If primary is not NULL it receives the hit object's pick id
+** (type << PICK_TYPE_SHIFT | index, PICK_NONE on a miss) and the hit
+** distance (-1 on a miss) for the pick and depth buffers; no extra ray
+** is cast for them.
+*/
+/**
+ * @brief trace shade 함수
+ *
+ * @param scene 파라미터
+ * @param hit_found 교차가 있으면 1
+ * @param hit 최근접 교차
+ * @param primary 픽 ID와 거리 출력 (NULL 가능)
+ *
+ * @return t_color 조명이 적용된 색, 교차가 없으면 검정
+ */
+t_color	trace_shade(t_scene *scene, int hit_found, t_hit *hit,
+		t_primary *primary)
+{
+	metrics_add_ray(&scene->render_state.metrics);
+	if (primary)
+		*primary = (t_primary){PICK_NONE, -1.0};
+	if (!hit_found)
+		return ((t_color){0, 0, 0});
+	if (primary)
+		*primary = (t_primary){(hit->obj_type << PICK_TYPE_SHIFT)
+			| hit->obj_index, hit->distance};
+	return (apply_lighting(scene, hit));
+}
+
+/*
+** Packets need the wide nodes; with the binary tree or without a BVH
+** every pixel is traced on its own.
+*/
+/**
+ * @brief trace packet enabled 함수
+ *
+ * @param scene 파라미터
+ *
+ * @return int 광선 묶음 탐색을 쓸 수 있으면 1
+ */
+int	trace_packet_enabled(t_scene *scene)
+{
+	t_bvh	*bvh;
+
+	bvh = scene->render_state.bvh;
+	return (bvh && bvh->enabled && bvh->root && bvh->width > 2
+		&& bvh->wide);
+}
+
+/*
+** Build the camera rays of the 2x2 block at (x, y) (lane = dy * 2 + dx)
+** and find their closest hits with one packet traversal, starting from
+** the culled root of the block's tile (tile_cull_update) when there is
+** one.
+*/
+/**
+ * @brief trace packet 함수
+ *
+ * @param scene 파라미터
+ * @param packet 출력: 레인별 광선과 최근접 교차
+ * @param x 블록 왼쪽 위 픽셀 x
+ * @param y 블록 왼쪽 위 픽셀 y
+ */
+void	trace_packet(t_scene *scene, t_ray_packet *packet, int x, int y)
+{
+	t_tile_cull	*tiles;
+	t_real		uv[2];
+	int			lane;
+
+	tiles = &scene->render_state.tiles;
+	packet->root = NULL;
+	if (tiles->roots)
+		packet->root = &tiles->roots[(y / TILE_CULL_SIZE) * tiles->cols
+			+ x / TILE_CULL_SIZE];
+	lane = 0;
+	while (lane < PACKET_LANES)
+	{
+		uv[0] = (2 * (x + lane % 2) / (t_real)WINDOW_WIDTH) - 1;
+		uv[1] = 1 - (2 * (y + lane / 2) / (t_real)WINDOW_HEIGHT);
+		packet->ray[lane] = create_camera_ray(&scene->camera, uv[0], uv[1]);
+		packet->hit[lane].distance = INFINITY;
+		lane++;
+	}
+	bvh_packet_intersect(scene->render_state.bvh, packet, scene);
+}
@@ -20,17 +20,17 @@
  * @param t0 파라미터
  * @param t1 파라미터
  */
-static void	update_bounds(double *tmin, double *tmax, double t0, double t1)
+static void	update_bounds(t_real *tmin, t_real *tmax, t_real t0, t_real t1)
 {
 	if (t0 > t1)
 	{
-		*tmin = max_double(*tmin, t1);
-		*tmax = min_double(*tmax, t0);
+		*tmin = max_real(*tmin, t1);
+		*tmax = min_real(*tmax, t0);
 	}
 	else
 	{
-		*tmin = max_double(*tmin, t0);
-		*tmax = min_double(*tmax, t1);
+		*tmin = max_real(*tmin, t0);
+		*tmax = min_real(*tmax, t1);
 	}
 }
 
@@ -44,11 +44,11 @@ static void	update_bounds(double *tmin, double *tmax, double t0, double t1)
  *
  * @return int 반환값
  */
-int	aabb_intersect(t_aabb box, t_ray ray, double *t_min, double *t_max)
+int	aabb_intersect(t_aabb box, t_ray ray, t_real *t_min, t_real *t_max)
 {
-	double	t[2];
-	double	tmin;
-	double	tmax;
+	t_real	t[2];
+	t_real	tmin;
+	t_real	tmax;
 
 	tmin = *t_min;
 	tmax = *t_max;
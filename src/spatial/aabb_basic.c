@@ -13,14 +13,14 @@
 #include "spatial.h"
 
 /**
- * @brief min double 함수
+ * @brief min real 함수
  *
  * @param a 파라미터
  * @param b 파라미터
  *
- * @return double 반환값
+ * @return t_real 반환값
  */
-double	min_double(double a, double b)
+t_real	min_real(t_real a, t_real b)
 {
 	if (a < b)
 		return (a);
@@ -28,14 +28,14 @@ double	min_double(double a, double b)
 }
 
 /**
- * @brief max double 함수
+ * @brief max real 함수
  *
  * @param a 파라미터
  * @param b 파라미터
  *
- * @return double 반환값
+ * @return t_real 반환값
  */
-double	max_double(double a, double b)
+t_real	max_real(t_real a, t_real b)
 {
 	if (a > b)
 		return (a);
@@ -71,12 +71,12 @@ t_aabb	aabb_merge(t_aabb a, t_aabb b)
 {
 	t_aabb	result;
 
-	result.min.x = min_double(a.min.x, b.min.x);
-	result.min.y = min_double(a.min.y, b.min.y);
-	result.min.z = min_double(a.min.z, b.min.z);
-	result.max.x = max_double(a.max.x, b.max.x);
-	result.max.y = max_double(a.max.y, b.max.y);
-	result.max.z = max_double(a.max.z, b.max.z);
+	result.min.x = min_real(a.min.x, b.min.x);
+	result.min.y = min_real(a.min.y, b.min.y);
+	result.min.z = min_real(a.min.z, b.min.z);
+	result.max.x = max_real(a.max.x, b.max.x);
+	result.max.y = max_real(a.max.y, b.max.y);
+	result.max.z = max_real(a.max.z, b.max.z);
 	return (result);
 }
 
@@ -85,16 +85,16 @@ t_aabb	aabb_merge(t_aabb a, t_aabb b)
  *
  * @param box 파라미터
  *
- * @return double 반환값
+ * @return t_real 반환값
  */
-double	aabb_surface_area(t_aabb box)
+t_real	aabb_surface_area(t_aabb box)
 {
-	double	dx;
-	double	dy;
-	double	dz;
+	t_real	dx;
+	t_real	dy;
+	t_real	dz;
 
 	dx = box.max.x - box.min.x;
 	dy = box.max.y - box.min.y;
 	dz = box.max.z - box.min.z;
-	return (2.0 * (dx * dy + dy * dz + dz * dx));
+	return (2 * (dx * dy + dy * dz + dz * dx));
 }
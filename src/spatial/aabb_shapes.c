@@ -11,7 +11,7 @@
 /* ************************************************************************** */
 
 #include "spatial.h"
-#include <math.h>
+#include <tgmath.h>
 
 /**
  * @brief aabb for sphere 함수
@@ -21,7 +21,7 @@
  *
  * @return t_aabb 반환값
  */
-t_aabb	aabb_for_sphere(t_vec3 center, double radius)
+t_aabb	aabb_for_sphere(t_vec3 center, t_real radius)
 {
 	t_aabb	box;
 	t_vec3	offset;
@@ -34,23 +34,34 @@ t_aabb	aabb_for_sphere(t_vec3 center, double radius)
 	return (box);
 }
 
-t_aabb	aabb_for_cylinder(t_vec3 center, t_vec3 axis, double radius,
-		double height)
+/**
+ * @brief aabb for cylinder 함수 - 원기둥의 정확한 경계 상자
+ *
+ * 양 끝 원판은 축 i 방향으로 radius * sqrt(1 - axis_i²)만큼 퍼진다.
+ *
+ * @param center 원기둥 중심 (높이의 가운데)
+ * @param axis 정규화된 축
+ * @param radius 반지름
+ * @param height 높이
+ *
+ * @return t_aabb 반환값
+ */
+t_aabb	aabb_for_cylinder(t_vec3 center, t_vec3 axis, t_real radius,
+		t_real height)
 {
 	t_aabb	box;
 	t_vec3	half_axis;
-	double	extent;
+	t_vec3	extent;
 
-	half_axis = vec3_multiply(axis, height / 2.0);
-	extent = radius + fabs(half_axis.x);
-	box.min.x = center.x - extent;
-	box.max.x = center.x + extent;
-	extent = radius + fabs(half_axis.y);
-	box.min.y = center.y - extent;
-	box.max.y = center.y + extent;
-	extent = radius + fabs(half_axis.z);
-	box.min.z = center.z - extent;
-	box.max.z = center.z + extent;
+	half_axis = vec3_multiply(axis, height / 2);
+	extent.x = fabs(half_axis.x) + radius * sqrt(fmax((t_real)0,
+				1 - axis.x * axis.x));
+	extent.y = fabs(half_axis.y) + radius * sqrt(fmax((t_real)0,
+				1 - axis.y * axis.y));
+	extent.z = fabs(half_axis.z) + radius * sqrt(fmax((t_real)0,
+				1 - axis.z * axis.z));
+	box.min = vec3_subtract(center, extent);
+	box.max = vec3_add(center, extent);
 	return (box);
 }
 
@@ -65,7 +76,7 @@ t_aabb	aabb_for_cylinder(t_vec3 center, t_vec3 axis, double radius,
 t_aabb	aabb_for_plane(t_vec3 point, t_vec3 normal)
 {
 	t_aabb	box;
-	double	large;
+	t_real	large;
 
 	large = 1000000.0;
 	(void)normal;
@@ -27,6 +27,10 @@ t_aabb	get_object_bounds(t_object_ref ref, void *scene_ptr)
 	t_scene	*scene;
 
 	scene = (t_scene *)scene_ptr;
+	if (ref.type == OBJ_INSTANCE)
+		return (scene->instances[ref.index].bounds);
+	if (ref.type == OBJ_MESH)
+		return (scene->meshes[ref.index].bounds);
 	if (ref.type == OBJ_SPHERE)
 		return (aabb_for_sphere(scene->spheres[ref.index].center,
 				scene->spheres[ref.index].radius));
@@ -53,6 +57,10 @@ t_vec3	get_object_center(t_object_ref ref, void *scene_ptr)
 	t_scene	*scene;
 
 	scene = (t_scene *)scene_ptr;
+	if (ref.type == OBJ_INSTANCE)
+		return (scene->instances[ref.index].center);
+	if (ref.type == OBJ_MESH)
+		return (scene->meshes[ref.index].center);
 	if (ref.type == OBJ_SPHERE)
 		return (scene->spheres[ref.index].center);
 	else if (ref.type == OBJ_CYLINDER)
@@ -14,58 +14,101 @@
 #include "bvh_internal.h"
 #include <stdlib.h>
 
-t_bvh_node	*create_leaf_node(t_object_ref *objects, int count, void *scene)
+t_bvh_node	*create_leaf_node(t_bvh_pool *pool, t_build_prim *prims,
+		int count, t_aabb bounds)
 {
 	t_bvh_node	*node;
 	int			i;
 
-	node = malloc(sizeof(t_bvh_node));
+	node = bvh_pool_node(pool);
 	if (!node)
 		return (NULL);
-	node->bounds = compute_bounds(objects, count, scene);
+	node->objects = bvh_pool_refs(pool, count);
+	if (!node->objects)
+		return (NULL);
+	node->bounds = bounds;
 	node->left = NULL;
 	node->right = NULL;
 	node->object_count = count;
 	node->depth = 0;
-	node->objects = malloc(sizeof(t_object_ref) * count);
-	if (!node->objects)
-	{
-		free(node);
-		return (NULL);
-	}
 	i = 0;
 	while (i < count)
 	{
-		node->objects[i] = objects[i];
+		node->objects[i] = prims[i].ref;
 		i++;
 	}
 	return (node);
 }
 
-t_bvh_node	*bvh_build_recursive(t_object_ref *objects, int count,
-		void *scene, int depth)
+/**
+ * @brief bvh build bounded 함수 - 경계 상자를 아는 범위의 하향식 빌드
+ *
+ * 부모의 파티션이 구한 상자를 받아, 각 단계에서 객체 목록을 한 번만
+ * 순회한다.
+ *
+ * @param sp 객체 범위, 경계 상자, 깊이
+ *
+ * @return t_bvh_node* 노드
+ */
+t_bvh_node	*bvh_build_bounded(t_split_params *sp)
 {
-	t_aabb				bounds;
-	int					axis;
 	t_partition_params	params;
-	t_split_params		sp;
+	t_bvh_node			*leaf;
+
+	if (sp->count <= 2 || sp->depth > 20)
+	{
+		leaf = create_leaf_node(sp->pool, sp->prims, sp->count,
+				sp->bounds);
+		if (leaf)
+			leaf->depth = sp->depth;
+		return (leaf);
+	}
+	params.prims = sp->prims;
+	params.count = sp->count;
+	params.axis = choose_split_axis(sp->bounds);
+	params.split = calculate_split_position(sp->bounds, params.axis);
+	sp->mid = partition_objects(&params);
+	return (create_split_node(sp, params.side));
+}
 
-	if (count <= 2 || depth > 20)
-		return (create_leaf_node(objects, count, scene));
-	bounds = compute_bounds(objects, count, scene);
-	axis = choose_split_axis(bounds);
-	params.objects = objects;
-	params.count = count;
-	params.axis = axis;
-	params.split = calculate_split_position(bounds, axis);
-	params.scene = scene;
-	sp.mid = partition_objects(&params);
-	sp.bounds = bounds;
-	sp.objects = objects;
+/**
+ * @brief bvh build recursive 함수 - 중앙 분할 하향식 빌드
+ *
+ * 객체마다 경계 상자와 중심을 한 번만 구해 두고, 분할은 그 배열만
+ * 순회한다. 노드는 bvh->pool에서 받는다.
+ *
+ * @param bvh 노드 풀을 가진 BVH
+ * @param objects 객체 참조 배열
+ * @param count 객체 수
+ * @param scene 파라미터
+ *
+ * @return t_bvh_node* 루트 노드 (메모리 부족 시 NULL)
+ */
+t_bvh_node	*bvh_build_recursive(t_bvh *bvh, t_object_ref *objects,
+		int count, void *scene)
+{
+	t_split_params	sp;
+	t_bvh_node		*root;
+	int				i;
+
+	sp.prims = malloc(sizeof(t_build_prim) * count);
+	if (!sp.prims)
+		return (NULL);
+	i = 0;
+	while (i < count)
+	{
+		sp.prims[i].ref = objects[i];
+		sp.prims[i].box = get_object_bounds(objects[i], scene);
+		sp.prims[i].center = get_object_center(objects[i], scene);
+		i++;
+	}
+	sp.pool = &bvh->pool;
+	sp.bounds = compute_bounds(sp.prims, count);
 	sp.count = count;
-	sp.scene = scene;
-	sp.depth = depth;
-	return (create_split_node(&sp));
+	sp.depth = 0;
+	root = bvh_build_bounded(&sp);
+	free(sp.prims);
+	return (root);
 }
 
 /**
@@ -80,10 +123,17 @@ void	bvh_build(t_bvh *bvh, t_object_ref *objects, int count, void *scene)
 {
 	if (!bvh || count == 0)
 		return ;
-	if (bvh->root)
-		bvh_node_destroy(bvh->root);
-	bvh->root = bvh_build_recursive(objects, count, scene, 0);
-	if (bvh->root)
-		bvh->root->depth = 0;
-	bvh->total_nodes = 1;
+	bvh->root = NULL;
+	if (!bvh_pool_reserve(&bvh->pool, count))
+		return ;
+	if (bvh->builder == BVH_BUILD_LBVH)
+		bvh->root = bvh_build_lbvh(bvh, objects, count, scene);
+	else if (bvh->builder == BVH_BUILD_SBVH)
+		bvh->root = bvh_build_sbvh(bvh, objects, count, scene);
+	else
+		bvh->root = bvh_build_recursive(bvh, objects, count, scene);
+	bvh->total_nodes = bvh->pool.nodes_used;
+	bvh->duplicates = (bvh->pool.refs_used > count);
+	if (bvh->width > 2)
+		bvh_collapse(bvh);
 }
@@ -14,18 +14,16 @@
 #include "bvh_internal.h"
 
 /**
- * @brief compute bounds 함수 - 연산 수행
+ * @brief compute bounds 함수 - 객체들의 경계 상자
  *
- * @param objects 파라미터
- * @param count 파라미터
- * @param scene 파라미터
+ * @param prims 빌드 객체 배열
+ * @param count 객체 수
  *
  * @return t_aabb 반환값
  */
-t_aabb	compute_bounds(t_object_ref *objects, int count, void *scene)
+t_aabb	compute_bounds(t_build_prim *prims, int count)
 {
 	t_aabb	bounds;
-	t_aabb	obj_bounds;
 	t_vec3	zero;
 	int		i;
 
@@ -34,48 +32,82 @@ t_aabb	compute_bounds(t_object_ref *objects, int count, void *scene)
 	zero.z = 0;
 	if (count == 0)
 		return (aabb_create(zero, zero));
-	bounds = get_object_bounds(objects[0], scene);
+	bounds = prims[0].box;
 	i = 1;
 	while (i < count)
 	{
-		obj_bounds = get_object_bounds(objects[i], scene);
-		bounds = aabb_merge(bounds, obj_bounds);
+		bounds = aabb_merge(bounds, prims[i].box);
 		i++;
 	}
 	return (bounds);
 }
 
+/*
+** Center of prim lies below the split position on the split axis.
+*/
+static int	goes_left(t_partition_params *params, t_build_prim *prim)
+{
+	return ((params->axis == 0 && prim->center.x < params->split)
+		|| (params->axis == 1 && prim->center.y < params->split)
+		|| (params->axis == 2 && prim->center.z < params->split));
+}
+
+static void	grow_side(t_partition_params *params, int side, t_aabb box,
+		int first)
+{
+	if (first)
+		params->side[side] = box;
+	else
+		params->side[side] = aabb_merge(params->side[side], box);
+}
+
+/*
+** All centers fell on one side: split the list in half instead.
+*/
+static int	split_halves(t_partition_params *params)
+{
+	int	mid;
+
+	mid = params->count / 2;
+	params->side[0] = compute_bounds(params->prims, mid);
+	params->side[1] = compute_bounds(params->prims + mid,
+			params->count - mid);
+	return (mid);
+}
+
 /**
- * @brief partition objects 함수
+ * @brief partition objects 함수 - 분할 위치 기준으로 객체 재배치
+ *
+ * 같은 순회에서 양쪽의 경계 상자도 구해 params->side에 남긴다.
  *
  * @param params 파라미터
  *
- * @return int 반환값
+ * @return int 왼쪽 객체 수
  */
 int	partition_objects(t_partition_params *params)
 {
 	int				i;
 	int				left_count;
-	t_object_ref	temp;
-	t_vec3			center;
+	t_build_prim	temp;
 
 	left_count = 0;
 	i = 0;
 	while (i < params->count)
 	{
-		center = get_object_center(params->objects[i], params->scene);
-		if ((params->axis == 0 && center.x < params->split)
-			|| (params->axis == 1 && center.y < params->split)
-			|| (params->axis == 2 && center.z < params->split))
+		if (goes_left(params, &params->prims[i]))
 		{
-			temp = params->objects[left_count];
-			params->objects[left_count] = params->objects[i];
-			params->objects[i] = temp;
+			temp = params->prims[left_count];
+			params->prims[left_count] = params->prims[i];
+			params->prims[i] = temp;
+			grow_side(params, 0, params->prims[left_count].box,
+				left_count == 0);
 			left_count++;
 		}
+		else
+			grow_side(params, 1, params->prims[i].box, i == left_count);
 		i++;
 	}
 	if (left_count == 0 || left_count == params->count)
-		return (params->count / 2);
+		return (split_halves(params));
 	return (left_count);
 }
@@ -12,7 +12,6 @@
 
 #include "spatial.h"
 #include "bvh_internal.h"
-#include <stdlib.h>
 
 /**
  * @brief choose split axis 함수
@@ -24,7 +23,7 @@
 int	choose_split_axis(t_aabb bounds)
 {
 	int		axis;
-	double	max_extent;
+	t_real	max_extent;
 
 	axis = 0;
 	if (bounds.max.y - bounds.min.y > bounds.max.x - bounds.min.x)
@@ -43,36 +42,46 @@ int	choose_split_axis(t_aabb bounds)
  * @param bounds 파라미터
  * @param axis 파라미터
  *
- * @return double 반환값
+ * @return t_real 반환값
  */
-double	calculate_split_position(t_aabb bounds, int axis)
+t_real	calculate_split_position(t_aabb bounds, int axis)
 {
 	if (axis == 0)
-		return ((bounds.min.x + bounds.max.x) / 2.0);
+		return ((bounds.min.x + bounds.max.x) / 2);
 	else if (axis == 1)
-		return ((bounds.min.y + bounds.max.y) / 2.0);
+		return ((bounds.min.y + bounds.max.y) / 2);
 	else
-		return ((bounds.min.z + bounds.max.z) / 2.0);
+		return ((bounds.min.z + bounds.max.z) / 2);
 }
 
-t_bvh_node	*create_split_node(t_split_params *sp)
+/**
+ * @brief create split node 함수 - 내부 노드와 두 자식 생성
+ *
+ * @param sp 분할된 객체 범위 (mid: 왼쪽 객체 수)
+ * @param side 파티션이 구한 왼쪽 / 오른쪽 경계 상자
+ *
+ * @return t_bvh_node* 내부 노드
+ */
+t_bvh_node	*create_split_node(t_split_params *sp, t_aabb *side)
 {
-	t_bvh_node	*node;
+	t_bvh_node		*node;
+	t_split_params	child;
 
-	node = malloc(sizeof(t_bvh_node));
+	node = bvh_pool_node(sp->pool);
 	if (!node)
 		return (NULL);
 	node->bounds = sp->bounds;
 	node->objects = NULL;
 	node->object_count = 0;
 	node->depth = sp->depth;
-	node->left = bvh_build_recursive(sp->objects, sp->mid,
-			sp->scene, sp->depth + 1);
-	node->right = bvh_build_recursive(sp->objects + sp->mid,
-			sp->count - sp->mid, sp->scene, sp->depth + 1);
-	if (node->left)
-		node->left->depth = sp->depth + 1;
-	if (node->right)
-		node->right->depth = sp->depth + 1;
+	child = *sp;
+	child.depth = sp->depth + 1;
+	child.bounds = side[0];
+	child.count = sp->mid;
+	node->left = bvh_build_bounded(&child);
+	child.bounds = side[1];
+	child.prims = sp->prims + sp->mid;
+	child.count = sp->count - sp->mid;
+	node->right = bvh_build_bounded(&child);
 	return (node);
 }
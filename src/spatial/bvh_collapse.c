@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_collapse.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/01 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/01 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include <stdlib.h>
+#include <math.h>
+
+static int	emit_node(t_collapse *c, t_bvh_node *node);
+
+/*
+** Count the nodes and leaf object references of the binary tree (upper
+** bounds for the wide arrays: every wide node comes from a binary node)
+** and merge the leaf boxes no larger than BVH_QUANT_HUGE into finite.
+*/
+static void	count_tree(t_bvh_node *node, int *nodes, int *refs,
+		t_aabb *finite)
+{
+	t_vec3	size;
+
+	if (!node)
+		return ;
+	(*nodes)++;
+	*refs += node->object_count;
+	size = vec3_subtract(node->bounds.max, node->bounds.min);
+	if (!node->left && !node->right && size.x <= BVH_QUANT_HUGE
+		&& size.y <= BVH_QUANT_HUGE && size.z <= BVH_QUANT_HUGE)
+		*finite = aabb_merge(*finite, node->bounds);
+	count_tree(node->left, nodes, refs, finite);
+	count_tree(node->right, nodes, refs, finite);
+}
+
+/*
+** Set the quantization frame of wide node w from its children's bounds
+** (a no-op unless the node stores quantized boxes).
+*/
+static void	frame_kids(t_bvh_wide *w, t_bvh_node **kids, int n)
+{
+	t_aabb	boxes[BVH_WIDE_MAX];
+	int		i;
+
+	i = 0;
+	while (i < n)
+	{
+		boxes[i] = kids[i]->bounds;
+		i++;
+	}
+	bvh_wide_frame(w, boxes, n);
+}
+
+/*
+** Fill slot i of wide node idx: inner children are emitted recursively,
+** leaf objects are copied to the flat reference array.
+*/
+static void	set_slot(t_collapse *c, int idx, int i, t_bvh_node *kid)
+{
+	t_bvh_wide	*w;
+	int			k;
+
+	w = &c->bvh->wide[idx];
+	bvh_wide_slot_box(w, i, kid->bounds);
+	if (kid->left || kid->right)
+	{
+		k = emit_node(c, kid);
+		c->bvh->wide[idx].child[i] = k;
+		return ;
+	}
+	w->child[i] = c->refs;
+	w->count[i] = kid->object_count;
+	k = 0;
+	while (k < kid->object_count)
+	{
+		c->bvh->wide_refs[c->refs] = kid->objects[k];
+		c->refs++;
+		k++;
+	}
+}
+
+/*
+** Emit the wide node for a binary node (a leaf root becomes a wide node
+** with one leaf child). Returns its index.
+*/
+static int	emit_node(t_collapse *c, t_bvh_node *node)
+{
+	t_bvh_node	*kids[BVH_WIDE_MAX + 1];
+	int			idx;
+	int			n;
+	int			i;
+
+	idx = c->nodes;
+	c->nodes++;
+	kids[0] = node;
+	n = 1;
+	if (node->left || node->right)
+		n = bvh_gather_children(node, kids, c->width);
+	c->bvh->wide[idx].n = n;
+	frame_kids(&c->bvh->wide[idx], kids, n);
+	i = 0;
+	while (i < BVH_WIDE_MAX)
+	{
+		if (i < n)
+			set_slot(c, idx, i, kids[i]);
+		else
+			bvh_wide_slot_box(&c->bvh->wide[idx], i, (t_aabb){{INFINITY,
+					INFINITY, INFINITY}, {-INFINITY, -INFINITY, -INFINITY}});
+		i++;
+	}
+	return (idx);
+}
+
+/**
+ * @brief bvh collapse 함수 - 이진 BVH를 넓은 노드(BVH4/BVH8)로 변환
+ *
+ * bvh->width개까지 자식을 모은 노드를 평면 배열로 만든다. 이진 트리는
+ * 그대로 두어 폭을 바꿔도 다시 빌드하지 않는다.
+ *
+ * @param bvh 파라미터
+ *
+ * @return int 성공 1, 메모리 부족이거나 넓은 탐색 스택(BVH_WIDE_STACK)이
+ *         모자라는 깊은 트리면 0 (이진 탐색 유지)
+ */
+int	bvh_collapse(t_bvh *bvh)
+{
+	t_collapse	c;
+
+	bvh_wide_free(bvh);
+	if (!bvh->root)
+		return (0);
+	c.nodes = 0;
+	c.refs = 0;
+	count_tree(bvh->root, &c.nodes, &c.refs, &bvh->wide_bounds);
+	bvh->wide = malloc(sizeof(t_bvh_wide) * c.nodes);
+	bvh->wide_refs = malloc(sizeof(t_object_ref) * (c.refs + 1));
+	if (!bvh->wide || !bvh->wide_refs)
+	{
+		bvh_wide_free(bvh);
+		return (0);
+	}
+	c.bvh = bvh;
+	c.width = (int)fmin(fmax(bvh->width, 2), BVH_WIDE_MAX);
+	c.nodes = 0;
+	c.refs = 0;
+	emit_node(&c, bvh->root);
+	bvh->wide_count = c.nodes;
+	if (bvh_wide_stack_fits(bvh))
+		return (1);
+	bvh_wide_free(bvh);
+	return (0);
+}
@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_collapse_gather.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/01 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/01 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+
+/*
+** Append a child unless it is missing or an empty leaf (the partition can
+** leave one side without objects).
+*/
+static void	add_child(t_bvh_node **kids, int *n, t_bvh_node *child)
+{
+	if (!child)
+		return ;
+	if (!child->left && !child->right && child->object_count == 0)
+		return ;
+	kids[*n] = child;
+	(*n)++;
+}
+
+/*
+** Inner child with the largest surface area, -1 if all are leaves.
+*/
+static int	widest_inner(t_bvh_node **kids, int n)
+{
+	int	best;
+	int	i;
+
+	best = -1;
+	i = 0;
+	while (i < n)
+	{
+		if ((kids[i]->left || kids[i]->right) && (best < 0
+				|| aabb_surface_area(kids[i]->bounds)
+				> aabb_surface_area(kids[best]->bounds)))
+			best = i;
+		i++;
+	}
+	return (best);
+}
+
+/**
+ * @brief bvh gather children 함수 - 넓은 노드의 자식 수집
+ *
+ * 이진 노드의 두 자식에서 시작해, 표면적이 가장 큰 내부 자식을 그
+ * 자식들로 바꾸는 일을 width개가 되거나 잎만 남을 때까지 반복한다.
+ *
+ * @param node 이진 내부 노드
+ * @param kids 출력 (BVH_WIDE_MAX + 1칸)
+ * @param width 노드 폭 (4 또는 8)
+ *
+ * @return int 자식 수
+ */
+int	bvh_gather_children(t_bvh_node *node, t_bvh_node **kids, int width)
+{
+	int	n;
+	int	best;
+
+	n = 0;
+	add_child(kids, &n, node->left);
+	add_child(kids, &n, node->right);
+	best = widest_inner(kids, n);
+	while (n < width && best >= 0)
+	{
+		node = kids[best];
+		n--;
+		kids[best] = kids[n];
+		add_child(kids, &n, node->left);
+		add_child(kids, &n, node->right);
+		best = widest_inner(kids, n);
+	}
+	return (n);
+}
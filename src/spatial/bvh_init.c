@@ -24,7 +24,8 @@
  */
 static int	count_objects(t_scene *scene)
 {
-	return (scene->sphere_count + scene->plane_count + scene->cylinder_count);
+	return (scene->sphere_count + scene->plane_count + scene->cylinder_count
+		+ scene->instance_count + scene->mesh_count);
 }
 
 /**
@@ -80,16 +81,36 @@ static void	fill_planes_cylinders(t_scene *scene, t_object_ref *refs, int *idx)
 /**
  * @brief fill object refs 함수
  *
+ * 인스턴스는 그룹 BVH를, 메시는 메시 BVH를 가리키는 하나의 참조로
+ * 들어간다 (2단계 BVH).
+ *
  * @param scene 파라미터
  * @param refs 파라미터
  */
 static void	fill_object_refs(t_scene *scene, t_object_ref *refs)
 {
 	int	idx;
+	int	i;
 
 	idx = 0;
 	fill_spheres(scene, refs, &idx);
 	fill_planes_cylinders(scene, refs, &idx);
+	i = 0;
+	while (i < scene->instance_count)
+	{
+		refs[idx].type = OBJ_INSTANCE;
+		refs[idx].index = i;
+		idx++;
+		i++;
+	}
+	i = 0;
+	while (i < scene->mesh_count)
+	{
+		refs[idx].type = OBJ_MESH;
+		refs[idx].index = i;
+		idx++;
+		i++;
+	}
 }
 
 /**
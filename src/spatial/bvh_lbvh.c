@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_lbvh.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/04 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/04 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include <stdlib.h>
+
+/*
+** Allocate the per-object arrays. Returns 0 if any allocation failed.
+*/
+static int	lbvh_alloc(t_lbvh *l, int count)
+{
+	l->count = count;
+	l->depth = 0;
+	l->centers = malloc(sizeof(t_vec3) * count);
+	l->boxes = malloc(sizeof(t_aabb) * count);
+	l->codes[0] = malloc(sizeof(unsigned int) * count);
+	l->codes[1] = malloc(sizeof(unsigned int) * count);
+	l->order[0] = malloc(sizeof(int) * count);
+	l->order[1] = malloc(sizeof(int) * count);
+	l->left = malloc(sizeof(int) * count);
+	l->right = malloc(sizeof(int) * count);
+	return (l->centers && l->boxes && l->codes[0] && l->codes[1]
+		&& l->order[0] && l->order[1] && l->left && l->right);
+}
+
+static void	lbvh_free(t_lbvh *l)
+{
+	free(l->centers);
+	free(l->boxes);
+	free(l->codes[0]);
+	free(l->codes[1]);
+	free(l->order[0]);
+	free(l->order[1]);
+	free(l->left);
+	free(l->right);
+}
+
+/**
+ * @brief lbvh build 함수 - 채워진 중심과 박스로 트리 생성
+ *
+ * 모턴 코드 계산, 기수 정렬, 계층 구성, 노드 생성이 모두 객체 수에
+ * 선형이다.
+ *
+ * @param l centers, boxes, refs가 채워진 빌드 상태
+ *
+ * @return t_bvh_node* 루트 노드
+ */
+t_bvh_node	*lbvh_build(t_lbvh *l)
+{
+	int	root;
+
+	lbvh_codes(l);
+	lbvh_sort(l);
+	root = lbvh_hierarchy(l);
+	return (lbvh_emit(l, root, 0, l->count - 1));
+}
+
+/**
+ * @brief bvh build lbvh 함수 - 모턴 코드 기반 선형 BVH 빌드
+ *
+ * 노드는 bvh->pool에서 받고, bvh->treelets면 트리릿 최적화를 한다.
+ * 메모리가 부족하면 중앙 분할 빌더로 대신 만든다.
+ *
+ * @param bvh 노드 풀을 가진 BVH
+ * @param objects 객체 참조 배열
+ * @param count 객체 수
+ * @param scene 파라미터
+ *
+ * @return t_bvh_node* 루트 노드
+ */
+t_bvh_node	*bvh_build_lbvh(t_bvh *bvh, t_object_ref *objects, int count,
+		void *scene)
+{
+	t_lbvh		l;
+	t_bvh_node	*root;
+	int			i;
+
+	root = NULL;
+	if (lbvh_alloc(&l, count))
+	{
+		l.refs = objects;
+		l.pool = &bvh->pool;
+		i = 0;
+		while (i < count)
+		{
+			l.centers[i] = get_object_center(objects[i], scene);
+			l.boxes[i] = get_object_bounds(objects[i], scene);
+			i++;
+		}
+		root = lbvh_build(&l);
+	}
+	lbvh_free(&l);
+	if (!root && bvh_pool_reserve(&bvh->pool, count))
+		return (bvh_build_recursive(bvh, objects, count, scene));
+	if (root && bvh->treelets)
+		bvh_treelet_optimize(root);
+	return (root);
+}
@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_lbvh_emit.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/04 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/04 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+
+/*
+** Leaf holding sorted objects first .. first + count - 1.
+*/
+static t_bvh_node	*lbvh_leaf(t_lbvh *l, int first, int count)
+{
+	t_bvh_node	*node;
+	int			k;
+	int			obj;
+
+	node = bvh_pool_node(l->pool);
+	if (!node)
+		return (NULL);
+	node->objects = bvh_pool_refs(l->pool, count);
+	if (!node->objects)
+		return (NULL);
+	node->left = NULL;
+	node->right = NULL;
+	node->object_count = count;
+	node->depth = l->depth;
+	node->bounds = l->boxes[l->order[LBVH_SORTED][first]];
+	k = 0;
+	while (k < count)
+	{
+		obj = l->order[LBVH_SORTED][first + k];
+		node->objects[k] = l->refs[obj];
+		node->bounds = aabb_merge(node->bounds, l->boxes[obj]);
+		k++;
+	}
+	return (node);
+}
+
+/**
+ * @brief lbvh emit 함수 - 계층에서 BVH 노드 생성
+ *
+ * 객체가 두 개 이하인 범위는 중앙 분할 빌더처럼 잎 하나가 된다.
+ *
+ * @param l 빌드 상태
+ * @param id 범위를 나누는 내부 노드
+ * @param first 범위의 첫 정렬 객체
+ * @param last 범위의 마지막 정렬 객체
+ *
+ * @return t_bvh_node* 노드 (풀이 부족하면 NULL)
+ */
+t_bvh_node	*lbvh_emit(t_lbvh *l, int id, int first, int last)
+{
+	t_bvh_node	*node;
+
+	if (last - first < 2)
+		return (lbvh_leaf(l, first, last - first + 1));
+	node = bvh_pool_node(l->pool);
+	if (!node)
+		return (NULL);
+	node->objects = NULL;
+	node->object_count = 0;
+	node->depth = l->depth++;
+	node->left = lbvh_emit(l, l->left[id], first, id);
+	node->right = lbvh_emit(l, l->right[id], id + 1, last);
+	l->depth--;
+	if (!node->left || !node->right)
+		return (NULL);
+	node->bounds = aabb_merge(node->left->bounds, node->right->bounds);
+	return (node);
+}
@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_lbvh_tree.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/04 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/04 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+
+/*
+** Common prefix length of sorted codes i and i + 1. Equal codes are told
+** apart by their positions, so every split is unique.
+*/
+static int	common_prefix(t_lbvh *l, int i)
+{
+	unsigned int	x;
+
+	x = l->codes[LBVH_SORTED][i] ^ l->codes[LBVH_SORTED][i + 1];
+	if (x == 0)
+		return (32 + __builtin_clz(i ^ (i + 1)));
+	return (__builtin_clz(x));
+}
+
+/*
+** Prefix lengths of all neighbouring codes, stored in the free radix
+** buffer codes[1 - LBVH_SORTED] so each is computed once.
+*/
+static unsigned int	*fill_prefixes(t_lbvh *l)
+{
+	unsigned int	*prefix;
+	int				i;
+
+	prefix = l->codes[1 - LBVH_SORTED];
+	i = 0;
+	while (i < l->count - 1)
+	{
+		prefix[i] = common_prefix(l, i);
+		i++;
+	}
+	return (prefix);
+}
+
+/**
+ * @brief lbvh hierarchy 함수 - 정렬된 코드의 이진 계층 (O(n))
+ *
+ * 내부 노드 i는 객체 i와 i + 1 사이를 나눈다. 공통 접두사가 가장 짧은
+ * 분할이 위로 가는 카르테시안 트리를 스택 하나로 만든다. 스택은 정렬이
+ * 끝나 비어 있는 order[1 - LBVH_SORTED]를 쓴다.
+ *
+ * @param l 빌드 상태
+ *
+ * @return int 루트 내부 노드, 객체가 하나면 -1
+ */
+int	lbvh_hierarchy(t_lbvh *l)
+{
+	unsigned int	*prefix;
+	int				*stack;
+	int				size;
+	int				last;
+	int				i;
+
+	prefix = fill_prefixes(l);
+	stack = l->order[1 - LBVH_SORTED];
+	size = 0;
+	i = 0;
+	while (i < l->count - 1)
+	{
+		last = -1;
+		while (size > 0 && prefix[stack[size - 1]] > prefix[i])
+			last = stack[--size];
+		l->left[i] = last;
+		l->right[i] = -1;
+		if (size > 0)
+			l->right[stack[size - 1]] = i;
+		stack[size++] = i;
+		i++;
+	}
+	if (size == 0)
+		return (-1);
+	return (stack[0]);
+}
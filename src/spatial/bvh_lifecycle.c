@@ -13,6 +13,7 @@
 #include "spatial.h"
 #include "bvh_internal.h"
 #include <stdlib.h>
+#include <math.h>
 
 t_bvh	*bvh_create(void)
 {
@@ -26,34 +27,63 @@ t_bvh	*bvh_create(void)
 	bvh->total_nodes = 0;
 	bvh->max_depth = 0;
 	bvh->visualize = 0;
+	bvh->width = BVH_DEFAULT_WIDTH;
+	bvh->wide = NULL;
+	bvh->wide_refs = NULL;
+	bvh->wide_count = 0;
+	bvh->builder = BVH_DEFAULT_BUILDER;
+	bvh->treelets = 1;
+	bvh->pool = (t_bvh_pool){NULL, NULL, 0, 0, 0, 0};
+	bvh->duplicates = 0;
+	bvh_mail_reset(&bvh->mail);
 	return (bvh);
 }
 
 /**
- * @brief bvh node destroy 함수 - 제거 및 메모리 해제 수행
+ * @brief bvh destroy 함수 - 제거 및 메모리 해제 수행
  *
- * @param node 파라미터
+ * @param bvh 파라미터
  */
-void	bvh_node_destroy(t_bvh_node *node)
+void	bvh_destroy(t_bvh *bvh)
 {
-	if (!node)
+	if (!bvh)
 		return ;
-	bvh_node_destroy(node->left);
-	bvh_node_destroy(node->right);
-	if (node->objects)
-		free(node->objects);
-	free(node);
+	bvh_pool_free(&bvh->pool);
+	bvh_wide_free(bvh);
+	free(bvh);
 }
 
 /**
- * @brief bvh destroy 함수 - 제거 및 메모리 해제 수행
+ * @brief bvh wide free 함수 - 넓은 노드 배열 해제
  *
  * @param bvh 파라미터
  */
-void	bvh_destroy(t_bvh *bvh)
+void	bvh_wide_free(t_bvh *bvh)
+{
+	free(bvh->wide);
+	free(bvh->wide_refs);
+	bvh->wide = NULL;
+	bvh->wide_refs = NULL;
+	bvh->wide_count = 0;
+	bvh->wide_bounds = (t_aabb){{INFINITY, INFINITY, INFINITY},
+	{-INFINITY, -INFINITY, -INFINITY}};
+}
+
+/**
+ * @brief bvh set width 함수 - 탐색할 노드 폭 선택 (2, 4, 8)
+ *
+ * 2는 이진 트리를 그대로 탐색하고, 4와 8은 이진 트리를 다시 접는다.
+ *
+ * @param bvh 파라미터
+ * @param width 노드 폭
+ */
+void	bvh_set_width(t_bvh *bvh, int width)
 {
 	if (!bvh)
 		return ;
-	bvh_node_destroy(bvh->root);
-	free(bvh);
+	bvh->width = width;
+	if (width > 2)
+		bvh_collapse(bvh);
+	else
+		bvh_wide_free(bvh);
 }
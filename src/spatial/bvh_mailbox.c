@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_mailbox.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/06 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/06 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+
+/**
+ * @brief bvh mail reset 함수 - 우편함 비우기
+ *
+ * @param mail 우편함
+ */
+void	bvh_mail_reset(t_bvh_mail *mail)
+{
+	int	type;
+	int	i;
+
+	type = 0;
+	while (type < BVH_MAIL_TYPES)
+	{
+		i = 0;
+		while (i < BVH_MAIL_OBJECTS)
+		{
+			mail->stamp[type][i] = 0;
+			mail->lanes[type][i] = 0;
+			i++;
+		}
+		type++;
+	}
+	mail->current = 0;
+}
+
+/**
+ * @brief bvh mail next 함수 - 새 광선 또는 묶음의 우편함 번호
+ *
+ * 참조가 중복된 트리에서만 쓴다. 번호가 한 바퀴 돌면 우편함을 비운다.
+ *
+ * @param bvh 파라미터
+ */
+void	bvh_mail_next(t_bvh *bvh)
+{
+	if (!bvh->duplicates)
+		return ;
+	bvh->mail.current++;
+	if (bvh->mail.current == 0)
+	{
+		bvh_mail_reset(&bvh->mail);
+		bvh->mail.current = 1;
+	}
+}
+
+/**
+ * @brief bvh mail lanes 함수 - 아직 객체를 검사하지 않은 레인
+ *
+ * 돌려준 레인은 검사한 것으로 기록한다. 중복이 없는 트리와 우편함
+ * 밖의 참조(인스턴스)는 mask를 그대로 돌려준다.
+ *
+ * @param bvh 파라미터
+ * @param ref 잎의 객체 참조
+ * @param mask 검사하려는 레인
+ *
+ * @return int 검사할 레인
+ */
+int	bvh_mail_lanes(t_bvh *bvh, t_object_ref ref, int mask)
+{
+	t_bvh_mail	*mail;
+
+	if (!bvh->duplicates || ref.type >= BVH_MAIL_TYPES
+		|| ref.index >= BVH_MAIL_OBJECTS)
+		return (mask);
+	mail = &bvh->mail;
+	if (mail->stamp[ref.type][ref.index] != mail->current)
+	{
+		mail->stamp[ref.type][ref.index] = mail->current;
+		mail->lanes[ref.type][ref.index] = 0;
+	}
+	mask &= ~mail->lanes[ref.type][ref.index];
+	mail->lanes[ref.type][ref.index] |= mask;
+	return (mask);
+}
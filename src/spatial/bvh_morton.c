@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_morton.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/04 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/04 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+
+/*
+** Spread the low 10 bits of v so two zero bits follow each one.
+*/
+static unsigned int	expand_bits(unsigned int v)
+{
+	v = (v * 0x00010001u) & 0xFF0000FFu;
+	v = (v * 0x00000101u) & 0x0F00F00Fu;
+	v = (v * 0x00000011u) & 0xC30C30C3u;
+	v = (v * 0x00000005u) & 0x49249249u;
+	return (v);
+}
+
+/*
+** Cell of v on a 2^MORTON_BITS grid over [lo, lo + 1 / scale].
+*/
+static unsigned int	quantize(t_real v, t_real lo, t_real scale)
+{
+	t_real	cell;
+
+	cell = (v - lo) * scale;
+	if (cell < 0)
+		cell = 0;
+	if (cell > (1 << MORTON_BITS) - 1)
+		cell = (1 << MORTON_BITS) - 1;
+	return ((unsigned int)cell);
+}
+
+/*
+** Grid cells per unit length on each axis of the centroid bounds.
+*/
+static t_vec3	grid_scale(t_aabb b)
+{
+	t_vec3	extent;
+	t_vec3	scale;
+	t_real	cells;
+
+	cells = (1 << MORTON_BITS) - 1;
+	extent = vec3_subtract(b.max, b.min);
+	scale = (t_vec3){0, 0, 0};
+	if (extent.x > EPSILON)
+		scale.x = cells / extent.x;
+	if (extent.y > EPSILON)
+		scale.y = cells / extent.y;
+	if (extent.z > EPSILON)
+		scale.z = cells / extent.z;
+	return (scale);
+}
+
+/**
+ * @brief lbvh codes 함수 - 객체 중심의 30비트 모턴 코드
+ *
+ * 중심들의 경계 상자를 축마다 1024칸으로 나누고 세 축의 비트를
+ * 교차시킨다. 정렬 전 순서(order[0])도 함께 채운다.
+ *
+ * @param l 빌드 상태
+ */
+void	lbvh_codes(t_lbvh *l)
+{
+	t_aabb	b;
+	t_vec3	s;
+	t_vec3	c;
+	int		i;
+
+	b = aabb_create(l->centers[0], l->centers[0]);
+	i = 1;
+	while (i < l->count)
+	{
+		b = aabb_merge(b, aabb_create(l->centers[i], l->centers[i]));
+		i++;
+	}
+	s = grid_scale(b);
+	i = 0;
+	while (i < l->count)
+	{
+		c = l->centers[i];
+		l->codes[0][i] = (expand_bits(quantize(c.x, b.min.x, s.x)) << 2)
+			| (expand_bits(quantize(c.y, b.min.y, s.y)) << 1)
+			| expand_bits(quantize(c.z, b.min.z, s.z));
+		l->order[0][i] = i;
+		i++;
+	}
+}
@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_packet.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/02 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/02 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include "minirt.h"
+#include "metrics.h"
+#include <tgmath.h>
+
+/*
+** Test the root box for every lane; the root entry carries the lanes
+** that enter it. Returns that lane mask.
+*/
+static int	root_entry(t_packet_trav *pt)
+{
+	t_real	t[2];
+	t_real	tmin;
+	int		mask;
+	int		lane;
+
+	mask = 0;
+	tmin = INFINITY;
+	lane = 0;
+	while (lane < PACKET_LANES)
+	{
+		t[0] = HIT_EPSILON;
+		t[1] = pt->packet->hit[lane].distance;
+		if (aabb_intersect(pt->bvh->root->bounds, pt->packet->ray[lane],
+				&t[0], &t[1]))
+		{
+			mask |= 1 << lane;
+			tmin = fmin(tmin, t[0]);
+		}
+		lane++;
+	}
+	pt->stack[0] = (t_wide_entry){0, 0, tmin, mask};
+	pt->size = (mask != 0);
+	return (mask);
+}
+
+/*
+** Prepare the slab ray of every lane and the first stack entries: the
+** children of the tile root (already culled against the tile frustum),
+** or the BVH root. Returns 0 if no lane can hit anything.
+*/
+static int	packet_init(t_packet_trav *pt, t_bvh *bvh, t_ray_packet *packet)
+{
+	int	lane;
+
+	pt->bvh = bvh;
+	pt->packet = packet;
+	pt->size = 0;
+	lane = 0;
+	while (lane < PACKET_LANES)
+	{
+		bvh_wide_ray_init(&pt->wr[lane], &packet->ray[lane]);
+		lane++;
+	}
+	if (!packet->root)
+		return (root_entry(pt));
+	bvh_packet_push(pt, packet->root, (1 << PACKET_LANES) - 1);
+	return (pt->size > 0);
+}
+
+/*
+** Farthest closest-hit distance among the lanes of mask: an entry
+** beyond it cannot improve any of them.
+*/
+static t_real	lane_far(t_packet_trav *pt, int mask)
+{
+	t_real	far;
+	int		lane;
+
+	far = 0.0;
+	lane = 0;
+	while (lane < PACKET_LANES)
+	{
+		if ((mask & (1 << lane)) && pt->packet->hit[lane].distance > far)
+			far = pt->packet->hit[lane].distance;
+		lane++;
+	}
+	return (far);
+}
+
+/*
+** The packet diverged to one lane: finish this subtree with the single
+** ray traversal, which skips the per-lane bookkeeping.
+*/
+static void	single_lane(t_packet_trav *pt, t_wide_entry *e)
+{
+	t_wide_trav	tr;
+	int			lane;
+
+	lane = 0;
+	while (!(e->mask & (1 << lane)))
+		lane++;
+	tr.bvh = pt->bvh;
+	tr.lane_bit = 1 << lane;
+	tr.ray = pt->packet->ray[lane];
+	tr.wr = pt->wr[lane];
+	tr.hit = &pt->packet->hit[lane];
+	tr.scene = pt->scene;
+	tr.stack[0] = *e;
+	tr.size = 1;
+	metrics_add_packet(&((t_scene *)pt->scene)->render_state.metrics,
+		e->mask, PACKET_LANES);
+	if (bvh_wide_run(&tr))
+		pt->packet->found |= e->mask;
+}
+
+/**
+ * @brief bvh packet intersect 함수 - 광선 묶음의 넓은 BVH 탐색
+ *
+ * 2x2 픽셀의 주 광선을 한 번에 탐색한다. 스택 항목마다 그 상자에
+ * 들어가는 레인 마스크를 두고, 레인이 하나만 남으면 단일 광선
+ * 탐색으로 넘긴다. packet->root가 있으면 타일 루트에서 시작한다.
+ * 결과는 레인별 단일 광선 탐색과 같다.
+ *
+ * @param bvh 넓은 노드가 만들어진 BVH
+ * @param packet 광선 묶음 (hit[i].distance는 상한으로 초기화)
+ * @param scene 파라미터
+ *
+ * @return int 교차한 레인이 있으면 1 (레인별 결과는 packet->found)
+ */
+int	bvh_packet_intersect(t_bvh *bvh, t_ray_packet *packet, void *scene)
+{
+	t_packet_trav	pt;
+	t_wide_entry	e;
+
+	packet->found = 0;
+	pt.scene = scene;
+	if (!packet_init(&pt, bvh, packet))
+		return (0);
+	bvh_mail_next(bvh);
+	while (pt.size > 0)
+	{
+		pt.size--;
+		e = pt.stack[pt.size];
+		if (e.t > lane_far(&pt, e.mask))
+			e.mask = 0;
+		if (e.mask && !(e.mask & (e.mask - 1)))
+			single_lane(&pt, &e);
+		else if (e.mask && e.count > 0)
+			bvh_packet_leaf(&pt, &e);
+		else if (e.mask)
+			bvh_packet_push(&pt, &bvh->wide[e.child], e.mask);
+	}
+	return (packet->found != 0);
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_packet_node.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/02 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/02 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include "minirt.h"
+#include "metrics.h"
+#include <tgmath.h>
+
+/*
+** Test one leaf object against every lane of mask, keeping each lane's
+** closest hit.
+*/
+static void	object_lanes(t_packet_trav *pt, t_object_ref ref, int mask)
+{
+	t_ray_packet	*p;
+	t_hit_record	temp;
+	int				lane;
+
+	p = pt->packet;
+	lane = 0;
+	while (lane < PACKET_LANES)
+	{
+		temp.distance = p->hit[lane].distance;
+		if ((mask & (1 << lane))
+			&& intersect_scene_object(pt->scene, ref, &p->ray[lane], &temp))
+		{
+			temp.obj_type = ref.type;
+			temp.obj_index = ref.index;
+			p->hit[lane] = temp;
+			p->found |= 1 << lane;
+		}
+		lane++;
+	}
+}
+
+/**
+ * @brief bvh packet leaf 함수 - 잎 객체를 활성 레인에 대해 검사
+ *
+ * 다른 잎에서 이미 검사한 레인은 빼고 검사한다 (SBVH 중복 참조).
+ *
+ * @param pt 묶음 탐색 상태
+ * @param e 잎 자식 항목 (mask: 활성 레인)
+ */
+void	bvh_packet_leaf(t_packet_trav *pt, t_wide_entry *e)
+{
+	t_object_ref	ref;
+	int				i;
+
+	metrics_add_packet(&((t_scene *)pt->scene)->render_state.metrics,
+		e->mask, PACKET_LANES);
+	i = 0;
+	while (i < e->count)
+	{
+		ref = pt->bvh->wide_refs[e->child + i];
+		object_lanes(pt, ref, bvh_mail_lanes(pt->bvh, ref, e->mask));
+		i++;
+	}
+}
+
+/*
+** Slab-test the children against one lane and merge the result: the
+** lane joins the mask of every child it enters before its closest hit.
+*/
+static void	lane_slab(t_packet_trav *pt, t_bvh_wide *node, int lane,
+		t_packet_kids *kids)
+{
+	t_real	tnear[BVH_WIDE_MAX];
+	int		c;
+
+	pt->wr[lane].tmax = pt->packet->hit[lane].distance;
+	bvh_wide_slab(node, &pt->wr[lane], tnear);
+	c = 0;
+	while (c < node->n)
+	{
+		if (tnear[c] < INFINITY)
+		{
+			kids->mask[c] |= 1 << lane;
+			kids->tnear[c] = fmin(kids->tnear[c], tnear[c]);
+		}
+		c++;
+	}
+}
+
+/*
+** Children lanes and nearest entry distances for the lanes of mask.
+*/
+static void	gather_kids(t_packet_trav *pt, t_bvh_wide *node, int mask,
+		t_packet_kids *kids)
+{
+	int	c;
+	int	lane;
+
+	c = 0;
+	while (c < node->n)
+	{
+		kids->tnear[c] = INFINITY;
+		kids->mask[c] = 0;
+		c++;
+	}
+	lane = 0;
+	while (lane < PACKET_LANES)
+	{
+		if (mask & (1 << lane))
+			lane_slab(pt, node, lane, kids);
+		lane++;
+	}
+}
+
+/**
+ * @brief bvh packet push 함수 - 자식을 레인 마스크와 함께 스택에 넣기
+ *
+ * 어느 레인이라도 들어가는 자식을 가장 가까운 진입 거리의 역순으로
+ * 넣어, 가장 가까운 자식을 먼저 방문한다.
+ *
+ * @param pt 묶음 탐색 상태
+ * @param node 넓은 내부 노드
+ * @param mask 활성 레인
+ */
+void	bvh_packet_push(t_packet_trav *pt, t_bvh_wide *node, int mask)
+{
+	t_packet_kids	kids;
+	int				order[BVH_WIDE_MAX];
+	int				n;
+	int				i;
+	int				c;
+
+	metrics_add_packet(&((t_scene *)pt->scene)->render_state.metrics,
+		mask, PACKET_LANES);
+	gather_kids(pt, node, mask, &kids);
+	n = bvh_wide_order(kids.tnear, node->n, order);
+	i = 0;
+	while (i < n)
+	{
+		c = order[i];
+		pt->stack[pt->size] = (t_wide_entry){node->child[c],
+			node->count[c], kids.tnear[c], kids.mask[c]};
+		pt->size++;
+		i++;
+	}
+}
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_pool.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/05 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/05 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include <stdlib.h>
+
+/**
+ * @brief bvh pool reserve 함수 - 빌드 한 번에 필요한 노드와 참조 확보
+ *
+ * 카운터를 되돌리고, 배열이 작을 때만 다시 할당한다. 같은 크기의
+ * 장면을 다시 빌드하면 할당이 없다.
+ *
+ * @param pool 노드 풀
+ * @param count 객체 수
+ *
+ * @return int 성공 1, 메모리 부족 0
+ */
+int	bvh_pool_reserve(t_bvh_pool *pool, int count)
+{
+	pool->nodes_used = 0;
+	pool->refs_used = 0;
+	if (2 * count - 1 <= pool->node_cap && count <= pool->ref_cap)
+		return (1);
+	bvh_pool_free(pool);
+	pool->nodes = malloc(sizeof(t_bvh_node) * (2 * count - 1));
+	pool->refs = malloc(sizeof(t_object_ref) * count);
+	if (!pool->nodes || !pool->refs)
+	{
+		bvh_pool_free(pool);
+		return (0);
+	}
+	pool->node_cap = 2 * count - 1;
+	pool->ref_cap = count;
+	return (1);
+}
+
+/**
+ * @brief bvh pool node 함수 - 다음 빈 노드
+ *
+ * @param pool 노드 풀
+ *
+ * @return t_bvh_node* 노드, 풀이 가득 차면 NULL
+ */
+t_bvh_node	*bvh_pool_node(t_bvh_pool *pool)
+{
+	if (pool->nodes_used >= pool->node_cap)
+		return (NULL);
+	return (&pool->nodes[pool->nodes_used++]);
+}
+
+/**
+ * @brief bvh pool refs 함수 - 잎 하나의 객체 참조 범위
+ *
+ * 잎은 만들어진 순서대로 refs의 연속 구간을 받는다.
+ *
+ * @param pool 노드 풀
+ * @param count 잎의 객체 수
+ *
+ * @return t_object_ref* 범위 시작, 공간이 없으면 NULL
+ */
+t_object_ref	*bvh_pool_refs(t_bvh_pool *pool, int count)
+{
+	t_object_ref	*refs;
+
+	if (pool->refs_used + count > pool->ref_cap)
+		return (NULL);
+	refs = pool->refs + pool->refs_used;
+	pool->refs_used += count;
+	return (refs);
+}
+
+/**
+ * @brief bvh pool free 함수 - 풀 배열 해제
+ *
+ * @param pool 노드 풀
+ */
+void	bvh_pool_free(t_bvh_pool *pool)
+{
+	free(pool->nodes);
+	free(pool->refs);
+	pool->nodes = NULL;
+	pool->refs = NULL;
+	pool->node_cap = 0;
+	pool->ref_cap = 0;
+	pool->nodes_used = 0;
+	pool->refs_used = 0;
+}
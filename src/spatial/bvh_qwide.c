@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_qwide.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/07 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/07 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include <math.h>
+
+/*
+** Quantized child boxes (make QBVH=1). A corner is decoded as
+** origin + q * scale in t_real, the same expression the slab test uses,
+** so the outward rounding here holds during traversal.
+*/
+#ifdef MINIRT_QBVH
+
+/*
+** Frame of one axis: float origin at or below lo, float scale such that
+** step 255 reaches hi.
+*/
+static void	frame_axis(t_bvh_wide *w, int a, t_real lo, t_real hi)
+{
+	if (lo > hi)
+	{
+		lo = 0.0;
+		hi = 0.0;
+	}
+	w->origin[a] = (float)lo;
+	if (w->origin[a] > lo)
+		w->origin[a] = nextafterf(w->origin[a], -INFINITY);
+	w->scale[a] = (float)((hi - w->origin[a]) / 255);
+	while (w->origin[a] + (t_real)255 * w->scale[a] < hi)
+		w->scale[a] = nextafterf(w->scale[a], INFINITY);
+}
+
+/**
+ * @brief bvh wide frame 함수 - 노드의 양자화 기준 틀 설정
+ *
+ * 틀은 BVH_QUANT_HUGE보다 작은 자식 상자들의 합이다. 자식 상자보다
+ * 먼저 정해야 한다.
+ *
+ * @param w 넓은 노드
+ * @param boxes 자식 상자
+ * @param n 자식 수
+ */
+void	bvh_wide_frame(t_bvh_wide *w, t_aabb *boxes, int n)
+{
+	t_aabb	frame;
+	t_aabb	b;
+	int		i;
+
+	frame.min = (t_vec3){INFINITY, INFINITY, INFINITY};
+	frame.max = (t_vec3){-INFINITY, -INFINITY, -INFINITY};
+	i = 0;
+	while (i < n)
+	{
+		b = boxes[i];
+		if (b.max.x - b.min.x <= BVH_QUANT_HUGE
+			&& b.max.y - b.min.y <= BVH_QUANT_HUGE
+			&& b.max.z - b.min.z <= BVH_QUANT_HUGE)
+			frame = aabb_merge(frame, b);
+		i++;
+	}
+	frame_axis(w, 0, frame.min.x, frame.max.x);
+	frame_axis(w, 1, frame.min.y, frame.max.y);
+	frame_axis(w, 2, frame.min.z, frame.max.z);
+	w->huge = 0;
+}
+
+/*
+** Steps of [lo, hi] on one axis, rounded outward: the largest step at or
+** below lo and the smallest at or above hi. Returns 0 if the range does
+** not fit in the frame (a box decoded from another node's frame).
+*/
+static int	encode_axis(t_bvh_wide *w, int a, int i, t_real *range)
+{
+	int	q;
+
+	if (range[0] < w->origin[a]
+		|| range[1] > w->origin[a] + (t_real)255 * w->scale[a])
+		return (0);
+	q = (int)fmin(fmax((range[0] - w->origin[a]) / w->scale[a], 0.0), 255.0);
+	while (q > 0 && w->origin[a] + (t_real)q * w->scale[a] > range[0])
+		q--;
+	while (q < 255 && w->origin[a] + (t_real)(q + 1) * w->scale[a]
+		<= range[0])
+		q++;
+	w->qmin[a][i] = (unsigned char)q;
+	q = (int)fmin(fmax(ceil((range[1] - w->origin[a]) / w->scale[a]), 0.0),
+			255.0);
+	while (q < 255 && w->origin[a] + (t_real)q * w->scale[a] < range[1])
+		q++;
+	while (q > 0 && w->origin[a] + (t_real)(q - 1) * w->scale[a] >= range[1])
+		q--;
+	w->qmax[a][i] = (unsigned char)q;
+	return (1);
+}
+
+/**
+ * @brief bvh wide slot box 함수 - 슬롯 i에 자식 상자를 양자화해 저장
+ *
+ * 자식 인덱스와 객체 수는 0으로 초기화한다 (내부 자식). 빈 상자는
+ * min > max로 저장한다. BVH_QUANT_HUGE보다 크거나 틀 밖으로 나가는
+ * 상자는 huge 비트로 표시해 항상 들어간다.
+ *
+ * @param w 틀이 정해진 넓은 노드
+ * @param i 슬롯
+ * @param box 자식 상자
+ */
+void	bvh_wide_slot_box(t_bvh_wide *w, int i, t_aabb box)
+{
+	t_real	range[2];
+	int		a;
+
+	w->huge &= ~(1 << i);
+	if (box.max.x - box.min.x > BVH_QUANT_HUGE
+		|| box.max.y - box.min.y > BVH_QUANT_HUGE
+		|| box.max.z - box.min.z > BVH_QUANT_HUGE)
+		w->huge |= 1 << i;
+	a = 0;
+	while (a < 3)
+	{
+		range[0] = sbvh_axis(box.min, a);
+		range[1] = sbvh_axis(box.max, a);
+		w->qmin[a][i] = 255;
+		w->qmax[a][i] = 0;
+		if (range[0] <= range[1] && !(w->huge & (1 << i))
+			&& !encode_axis(w, a, i, range))
+			w->huge |= 1 << i;
+		a++;
+	}
+	w->child[i] = 0;
+	w->count[i] = 0;
+}
+
+#endif
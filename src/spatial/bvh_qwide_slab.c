@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_qwide_slab.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/07 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/07 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include <math.h>
+
+/*
+** Decoding of quantized child boxes (make QBVH=1). A corner is
+** origin + q * scale in t_real, the expression bvh_qwide.c rounds
+** outward, so every decoded box contains the stored one. A huge child
+** (a plane) is always entered at tnear = 0.
+*/
+#ifdef MINIRT_QBVH
+
+static void	slab_axis(t_real lo, t_real hi, t_real *near, t_real *far)
+{
+	t_real	swap;
+
+	if (lo > hi)
+	{
+		swap = lo;
+		lo = hi;
+		hi = swap;
+	}
+	if (lo > *near)
+		*near = lo;
+	if (hi < *far)
+		*far = hi;
+}
+
+/*
+** Entry distance of child i, INFINITY on a miss.
+*/
+static t_real	slab_child(t_bvh_wide *node, t_wide_ray *ray, int i)
+{
+	t_real	near;
+	t_real	far;
+	int		a;
+
+	if (node->huge & (1 << i))
+		return (0);
+	near = 0;
+	far = ray->tmax;
+	a = 0;
+	while (a < 3)
+	{
+		slab_axis((node->origin[a] + (t_real)node->qmin[a][i] * node->scale[a]
+				- ray->org[a]) * ray->inv[a],
+			(node->origin[a] + (t_real)node->qmax[a][i] * node->scale[a]
+				- ray->org[a]) * ray->inv[a], &near, &far);
+		a++;
+	}
+	if (near > far)
+		return (INFINITY);
+	return (near);
+}
+
+/*
+** Slab test of every child against one ray; tnear[i] as in
+** bvh_wide_slab.c.
+*/
+void	bvh_wide_slab(t_bvh_wide *node, t_wide_ray *ray, t_real *tnear)
+{
+	int	i;
+
+	i = 0;
+	while (i < node->n)
+	{
+		tnear[i] = slab_child(node, ray, i);
+		i++;
+	}
+}
+
+/**
+ * @brief bvh wide box 함수 - 슬롯 i의 자식 상자 복원
+ *
+ * huge 자식은 모든 축이 무한한 상자다.
+ *
+ * @param w 넓은 노드
+ * @param i 슬롯
+ *
+ * @return t_aabb 자식 상자 (저장 전 상자를 포함)
+ */
+t_aabb	bvh_wide_box(t_bvh_wide *w, int i)
+{
+	t_aabb	box;
+
+	if (w->huge & (1 << i))
+		return ((t_aabb){{-INFINITY, -INFINITY, -INFINITY},
+			{INFINITY, INFINITY, INFINITY}});
+	box.min.x = w->origin[0] + (t_real)w->qmin[0][i] * w->scale[0];
+	box.min.y = w->origin[1] + (t_real)w->qmin[1][i] * w->scale[1];
+	box.min.z = w->origin[2] + (t_real)w->qmin[2][i] * w->scale[2];
+	box.max.x = w->origin[0] + (t_real)w->qmax[0][i] * w->scale[0];
+	box.max.y = w->origin[1] + (t_real)w->qmax[1][i] * w->scale[1];
+	box.max.z = w->origin[2] + (t_real)w->qmax[2][i] * w->scale[2];
+	return (box);
+}
+
+#endif
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_radix.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/04 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/04 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+
+/*
+** Start position of every digit in the output (exclusive prefix sum of
+** the digit histogram of keys).
+*/
+static void	radix_starts(unsigned int *keys, int count, int shift,
+		int *start)
+{
+	int	digit;
+	int	sum;
+	int	n;
+	int	i;
+
+	i = 0;
+	while (i < (1 << RADIX_BITS))
+		start[i++] = 0;
+	i = 0;
+	while (i < count)
+		start[(keys[i++] >> shift) & ((1 << RADIX_BITS) - 1)]++;
+	sum = 0;
+	digit = 0;
+	while (digit < (1 << RADIX_BITS))
+	{
+		n = start[digit];
+		start[digit] = sum;
+		sum += n;
+		digit++;
+	}
+}
+
+/*
+** One stable counting pass on a RADIX_BITS digit: buffer from to 1 - from.
+*/
+static void	radix_pass(t_lbvh *l, int from, int shift)
+{
+	int				start[1 << RADIX_BITS];
+	unsigned int	key;
+	int				pos;
+	int				i;
+
+	radix_starts(l->codes[from], l->count, shift, start);
+	i = 0;
+	while (i < l->count)
+	{
+		key = l->codes[from][i];
+		pos = start[(key >> shift) & ((1 << RADIX_BITS) - 1)]++;
+		l->codes[1 - from][pos] = key;
+		l->order[1 - from][pos] = l->order[from][i];
+		i++;
+	}
+}
+
+/**
+ * @brief lbvh sort 함수 - 모턴 코드 LSD 기수 정렬
+ *
+ * 10비트씩 세 번 정렬하므로 결과는 LBVH_SORTED 버퍼에 남는다.
+ *
+ * @param l 빌드 상태
+ */
+void	lbvh_sort(t_lbvh *l)
+{
+	int	pass;
+
+	pass = 0;
+	while (pass * RADIX_BITS < 3 * MORTON_BITS)
+	{
+		radix_pass(l, pass % 2, pass * RADIX_BITS);
+		pass++;
+	}
+}
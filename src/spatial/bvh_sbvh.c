@@ -0,0 +1,177 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_sbvh.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/06 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/06 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include <stdlib.h>
+#include <math.h>
+
+/*
+** Leaf holding every reference of the node.
+*/
+static t_bvh_node	*sbvh_leaf(t_sbvh *s, t_sbvh_ref *refs, int count,
+		t_aabb bounds)
+{
+	t_bvh_node	*node;
+	int			i;
+
+	node = bvh_pool_node(s->pool);
+	if (!node)
+		return (NULL);
+	node->objects = bvh_pool_refs(s->pool, count);
+	if (!node->objects)
+		return (NULL);
+	node->bounds = bounds;
+	node->left = NULL;
+	node->right = NULL;
+	node->object_count = count;
+	node->depth = s->depth;
+	i = 0;
+	while (i < count)
+	{
+		node->objects[i] = refs[i].ref;
+		i++;
+	}
+	return (node);
+}
+
+/*
+** Inner node over the partitioned references (left at child, right at
+** child + count).
+*/
+static t_bvh_node	*sbvh_inner(t_sbvh *s, t_sbvh_ref *child, int count,
+		t_sbvh_split *split)
+{
+	t_bvh_node	*node;
+
+	node = bvh_pool_node(s->pool);
+	if (!node)
+		return (NULL);
+	node->bounds = s->bounds;
+	node->objects = NULL;
+	node->object_count = 0;
+	node->depth = s->depth;
+	s->depth++;
+	node->left = sbvh_node(s, child, split->count[0], split->side[0]);
+	node->right = sbvh_node(s, child + count, split->count[1],
+			split->side[1]);
+	s->depth--;
+	if (!node->left || !node->right)
+		return (NULL);
+	return (node);
+}
+
+/**
+ * @brief sbvh node 함수 - 참조 범위의 SBVH 하위 트리
+ *
+ * 분할이 없거나, 예산이 떨어져 한쪽이 비면 잎으로 만든다.
+ *
+ * @param s 빌드 상태
+ * @param refs 노드의 참조
+ * @param count 참조 수
+ * @param bounds 참조들의 경계 상자
+ *
+ * @return t_bvh_node* 노드 (메모리 부족 시 NULL)
+ */
+t_bvh_node	*sbvh_node(t_sbvh *s, t_sbvh_ref *refs, int count,
+		t_aabb bounds)
+{
+	t_sbvh_split	split;
+	t_sbvh_ref		*child;
+	t_bvh_node		*node;
+
+	if (count <= 2 || s->depth > 20)
+		return (sbvh_leaf(s, refs, count, bounds));
+	s->bounds = bounds;
+	sbvh_choose_split(s, refs, count, &split);
+	if (split.cost == INFINITY)
+		return (sbvh_leaf(s, refs, count, bounds));
+	child = sbvh_partition(s, refs, count, &split);
+	if (!child)
+		return (NULL);
+	if (split.count[0] == 0 || split.count[1] == 0)
+		node = sbvh_leaf(s, refs, count, bounds);
+	else
+		node = sbvh_inner(s, child, count, &split);
+	free(child);
+	return (node);
+}
+
+/*
+** Object references with their full bounds; sets the root bounds and
+** the area the spatial split threshold is relative to.
+*/
+static t_sbvh_ref	*sbvh_refs(t_sbvh *s, t_object_ref *objects, int count)
+{
+	t_sbvh_ref	*refs;
+	t_aabb		centers;
+	t_vec3		c;
+	int			i;
+
+	refs = malloc(sizeof(t_sbvh_ref) * count);
+	if (!refs)
+		return (NULL);
+	c = get_object_center(objects[0], s->scene);
+	centers = aabb_create(c, c);
+	s->bounds = get_object_bounds(objects[0], s->scene);
+	i = 0;
+	while (i < count)
+	{
+		refs[i].ref = objects[i];
+		refs[i].box = get_object_bounds(objects[i], s->scene);
+		c = get_object_center(objects[i], s->scene);
+		s->bounds = aabb_merge(s->bounds, refs[i].box);
+		centers = aabb_merge(centers, aabb_create(c, c));
+		i++;
+	}
+	s->root_area = aabb_surface_area(centers);
+	return (refs);
+}
+
+/**
+ * @brief bvh build sbvh 함수 - 공간 분할 SAH BVH 빌드
+ *
+ * 객체 분할과 공간 분할(평면에 걸친 참조를 양쪽으로 잘라 넣기) 중
+ * SAH 비용이 낮은 쪽을 고른다. 길고 서로 겹치는 원기둥에서 노드
+ * 겹침이 줄어든다. 중복 참조는 객체 수의 SBVH_BUDGET%까지이고,
+ * 탐색은 우편함으로 같은 객체를 한 광선에 두 번 검사하지 않는다.
+ * 메모리가 부족하면 중앙 분할 빌더로 대신 만든다.
+ *
+ * @param bvh 노드 풀을 가진 BVH
+ * @param objects 객체 참조 배열
+ * @param count 객체 수
+ * @param scene 파라미터
+ *
+ * @return t_bvh_node* 루트 노드
+ */
+t_bvh_node	*bvh_build_sbvh(t_bvh *bvh, t_object_ref *objects, int count,
+		void *scene)
+{
+	t_sbvh		s;
+	t_sbvh_ref	*refs;
+	t_bvh_node	*root;
+
+	root = NULL;
+	s.pool = &bvh->pool;
+	s.scene = scene;
+	s.budget = count * SBVH_BUDGET / 100;
+	s.depth = 0;
+	refs = NULL;
+	if (bvh_pool_reserve(&bvh->pool, count + s.budget))
+		refs = sbvh_refs(&s, objects, count);
+	if (refs)
+		root = sbvh_node(&s, refs, count, s.bounds);
+	free(refs);
+	if (!root && bvh_pool_reserve(&bvh->pool, count))
+		return (bvh_build_recursive(bvh, objects, count, scene));
+	return (root);
+}
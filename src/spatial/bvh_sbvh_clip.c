@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_sbvh_clip.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/06 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/06 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include "minirt.h"
+#include "window.h"
+#include <tgmath.h>
+
+/**
+ * @brief sbvh axis 함수 - 벡터의 한 축 성분
+ *
+ * @param v 벡터
+ * @param axis 0, 1, 2 (x, y, z)
+ *
+ * @return t_real 성분
+ */
+t_real	sbvh_axis(t_vec3 v, int axis)
+{
+	if (axis == 0)
+		return (v.x);
+	if (axis == 1)
+		return (v.y);
+	return (v.z);
+}
+
+static t_real	*axis_ptr(t_vec3 *v, int axis)
+{
+	if (axis == 0)
+		return (&v->x);
+	if (axis == 1)
+		return (&v->y);
+	return (&v->z);
+}
+
+/*
+** Axis range [t[0], t[1]] of the cylinder part whose cross-section disk,
+** c + t * d +- r * sqrt(1 - d^2) on the clip axis, overlaps the slab.
+** Returns 0 if no part does.
+*/
+static int	cylinder_range(t_cylinder *cy, int axis, t_real *slab, t_real *t)
+{
+	t_real	c;
+	t_real	d;
+	t_real	e;
+	t_real	ta;
+	t_real	tb;
+
+	c = sbvh_axis(cy->center, axis);
+	d = sbvh_axis(cy->axis, axis);
+	e = cy->radius * sqrt(fmax((t_real)0, 1 - d * d));
+	t[0] = -cy->half_height;
+	t[1] = cy->half_height;
+	if (fabs(d) < EPSILON)
+		return (c - e <= slab[1] && c + e >= slab[0]);
+	ta = (slab[0] - e - c) / d;
+	tb = (slab[1] + e - c) / d;
+	t[0] = fmax(t[0], fmin(ta, tb));
+	t[1] = fmin(t[1], fmax(ta, tb));
+	return (t[0] <= t[1]);
+}
+
+/*
+** Box of the cylinder part between t[0] and t[1]: its two end disks,
+** each r * sqrt(1 - d_i^2) wide on axis i.
+*/
+static t_aabb	cylinder_box(t_cylinder *cy, t_real *t)
+{
+	t_vec3	a;
+	t_vec3	b;
+	t_vec3	e;
+	t_aabb	box;
+
+	a = vec3_add(cy->center, vec3_multiply(cy->axis, t[0]));
+	b = vec3_add(cy->center, vec3_multiply(cy->axis, t[1]));
+	e.x = cy->radius * sqrt(fmax((t_real)0, 1 - cy->axis.x * cy->axis.x));
+	e.y = cy->radius * sqrt(fmax((t_real)0, 1 - cy->axis.y * cy->axis.y));
+	e.z = cy->radius * sqrt(fmax((t_real)0, 1 - cy->axis.z * cy->axis.z));
+	box = aabb_merge(aabb_create(a, a), aabb_create(b, b));
+	box.min = vec3_subtract(box.min, e);
+	box.max = vec3_add(box.max, e);
+	return (box);
+}
+
+/**
+ * @brief sbvh clip 함수 - 참조를 축 방향 구간으로 자르기
+ *
+ * 원기둥은 구간 안에 든 부분의 상자를 다시 구하고, 다른 객체는
+ * 상자만 자른다. 결과는 원래 상자 안에 있다.
+ *
+ * @param s 빌드 상태
+ * @param r 자를 참조 (box가 잘린 상자로 바뀜)
+ * @param axis 분할 축
+ * @param slab 구간 [slab[0], slab[1]]
+ *
+ * @return int 구간 안에 남는 부분이 있으면 1
+ */
+int	sbvh_clip(t_sbvh *s, t_sbvh_ref *r, int axis, t_real *slab)
+{
+	t_cylinder	*cy;
+	t_aabb		box;
+	t_real		t[2];
+
+	box = r->box;
+	if (r->ref.type == OBJ_CYLINDER)
+	{
+		cy = &((t_scene *)s->scene)->cylinders[r->ref.index];
+		if (!cylinder_range(cy, axis, slab, t))
+			return (0);
+		box = cylinder_box(cy, t);
+	}
+	*axis_ptr(&box.min, axis) = fmax(sbvh_axis(box.min, axis), slab[0]);
+	*axis_ptr(&box.max, axis) = fmin(sbvh_axis(box.max, axis), slab[1]);
+	r->box.min = (t_vec3){fmax(box.min.x, r->box.min.x),
+		fmax(box.min.y, r->box.min.y), fmax(box.min.z, r->box.min.z)};
+	r->box.max = (t_vec3){fmin(box.max.x, r->box.max.x),
+		fmin(box.max.y, r->box.max.y), fmin(box.max.z, r->box.max.z)};
+	return (r->box.min.x <= r->box.max.x && r->box.min.y <= r->box.max.y
+		&& r->box.min.z <= r->box.max.z);
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_sbvh_object.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/06 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/06 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include <tgmath.h>
+
+/**
+ * @brief sbvh center 함수 - 참조 상자 중심의 한 축 좌표
+ *
+ * @param r 참조
+ * @param axis 축
+ *
+ * @return t_real 좌표
+ */
+t_real	sbvh_center(t_sbvh_ref *r, int axis)
+{
+	return ((sbvh_axis(r->box.min, axis) + sbvh_axis(r->box.max, axis))
+		/ 2);
+}
+
+/*
+** Lowest and highest reference center on the axis.
+*/
+static void	center_range(t_sbvh_ref *refs, int count, int axis,
+		t_real *range)
+{
+	t_real	c;
+	int		i;
+
+	range[0] = INFINITY;
+	range[1] = -INFINITY;
+	i = 0;
+	while (i < count)
+	{
+		c = sbvh_center(&refs[i], axis);
+		range[0] = fmin(range[0], c);
+		range[1] = fmax(range[1], c);
+		i++;
+	}
+}
+
+/*
+** Each reference goes whole into the bin of its center.
+*/
+static void	fill_bins(t_sbvh_ref *refs, int count, t_sbvh_split *cand,
+		t_sbvh_bin *bins)
+{
+	int	b;
+	int	i;
+
+	sbvh_bins_clear(bins);
+	i = 0;
+	while (i < count)
+	{
+		b = sbvh_bin(cand, sbvh_center(&refs[i], cand->axis));
+		bins[b].box = aabb_merge(bins[b].box, refs[i].box);
+		bins[b].enter++;
+		bins[b].exit++;
+		i++;
+	}
+}
+
+/**
+ * @brief sbvh object split 함수 - 중심 구간으로 나누는 최선의 분할
+ *
+ * 세 축 모두 SBVH_BINS개 구간으로 나눠 SAH 비용이 가장 낮은 경계를
+ * 고른다. 모든 중심이 한 점이면 best->cost는 INFINITY로 남는다.
+ *
+ * @param refs 노드의 참조
+ * @param count 참조 수
+ * @param best 결과 분할
+ */
+void	sbvh_object_split(t_sbvh_ref *refs, int count, t_sbvh_split *best)
+{
+	t_sbvh_bin		bins[SBVH_BINS];
+	t_sbvh_split	cand;
+	t_real			range[2];
+
+	best->cost = INFINITY;
+	cand.spatial = 0;
+	cand.axis = 0;
+	while (cand.axis < 3)
+	{
+		center_range(refs, count, cand.axis, range);
+		cand.lo = range[0];
+		cand.width = (range[1] - range[0]) / SBVH_BINS;
+		if (cand.width > 0)
+		{
+			fill_bins(refs, count, &cand, bins);
+			sbvh_sweep(bins, &cand, best);
+		}
+		cand.axis++;
+	}
+}
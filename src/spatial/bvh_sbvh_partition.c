@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_sbvh_partition.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/06 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/06 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include <stdlib.h>
+#include <math.h>
+
+/*
+** Append a reference to one child and grow the child bounds.
+*/
+static void	put(t_sbvh_ref **child, t_sbvh_split *split, int side,
+		t_sbvh_ref *r)
+{
+	child[side][split->count[side]] = *r;
+	if (split->count[side] == 0)
+		split->side[side] = r->box;
+	else
+		split->side[side] = aabb_merge(split->side[side], r->box);
+	split->count[side]++;
+}
+
+/*
+** Child of a reference: 0 left, 1 right, 2 crossing the spatial split
+** plane.
+*/
+static int	ref_side(t_sbvh_split *split, t_sbvh_ref *r)
+{
+	if (!split->spatial)
+		return (sbvh_bin(split, sbvh_center(r, split->axis))
+			>= split->plane);
+	if (sbvh_bin(split, sbvh_axis(r->box.max, split->axis)) < split->plane)
+		return (0);
+	if (sbvh_bin(split, sbvh_axis(r->box.min, split->axis)) >= split->plane)
+		return (1);
+	return (2);
+}
+
+/*
+** A reference crossing the plane goes to both children, clipped to
+** each side, while the duplicate budget lasts; after that it goes whole
+** to the side of its center. A clip that leaves nothing on one side
+** needs no duplicate.
+*/
+static void	straddle(t_sbvh *s, t_sbvh_ref **child, t_sbvh_split *split,
+		t_sbvh_ref *r)
+{
+	t_sbvh_ref	part[2];
+	t_real		lo[2];
+	t_real		hi[2];
+	int			keep[2];
+
+	lo[0] = -INFINITY;
+	lo[1] = split->lo + split->plane * split->width;
+	hi[0] = lo[1];
+	hi[1] = INFINITY;
+	part[0] = *r;
+	part[1] = *r;
+	keep[0] = sbvh_clip(s, &part[0], split->axis, lo);
+	keep[1] = sbvh_clip(s, &part[1], split->axis, hi);
+	if (keep[0] != keep[1])
+		put(child, split, keep[1], &part[keep[1]]);
+	else if (keep[0] && s->budget > 0)
+	{
+		s->budget--;
+		put(child, split, 0, &part[0]);
+		put(child, split, 1, &part[1]);
+	}
+	else
+		put(child, split, sbvh_bin(split, sbvh_center(r, split->axis))
+			>= split->plane, r);
+}
+
+/**
+ * @brief sbvh partition 함수 - 분할에 따라 참조를 두 자식에 나누기
+ *
+ * 자식 개수와 경계 상자는 실제로 넣은 참조로 다시 구한다 (예산이
+ * 떨어지면 SAH 계산과 달라질 수 있다).
+ *
+ * @param s 빌드 상태
+ * @param refs 노드의 참조
+ * @param count 참조 수
+ * @param split 고른 분할 (count, side가 결과로 바뀜)
+ *
+ * @return t_sbvh_ref* 왼쪽은 [0], 오른쪽은 [count]부터 (실패 시 NULL)
+ */
+t_sbvh_ref	*sbvh_partition(t_sbvh *s, t_sbvh_ref *refs, int count,
+		t_sbvh_split *split)
+{
+	t_sbvh_ref	*child[2];
+	int			side;
+	int			i;
+
+	child[0] = malloc(sizeof(t_sbvh_ref) * 2 * count);
+	if (!child[0])
+		return (NULL);
+	child[1] = child[0] + count;
+	split->count[0] = 0;
+	split->count[1] = 0;
+	i = 0;
+	while (i < count)
+	{
+		side = ref_side(split, &refs[i]);
+		if (side == 2)
+			straddle(s, child, split, &refs[i]);
+		else
+			put(child, split, side, &refs[i]);
+		i++;
+	}
+	return (child[0]);
+}
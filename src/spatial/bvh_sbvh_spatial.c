@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_sbvh_spatial.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/06 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/06 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include <tgmath.h>
+
+/*
+** Clip a reference into every bin its box spans: it enters the first
+** bin and exits the last.
+*/
+static void	bin_ref(t_sbvh *s, t_sbvh_ref *r, t_sbvh_split *cand,
+		t_sbvh_bin *bins)
+{
+	t_sbvh_ref	part;
+	t_real		slab[2];
+	int			b;
+	int			last;
+
+	b = sbvh_bin(cand, sbvh_axis(r->box.min, cand->axis));
+	last = sbvh_bin(cand, sbvh_axis(r->box.max, cand->axis));
+	bins[b].enter++;
+	bins[last].exit++;
+	if (b == last)
+	{
+		bins[b].box = aabb_merge(bins[b].box, r->box);
+		return ;
+	}
+	while (b <= last)
+	{
+		part = *r;
+		slab[0] = cand->lo + b * cand->width;
+		slab[1] = cand->lo + (b + 1) * cand->width;
+		if (sbvh_clip(s, &part, cand->axis, slab))
+			bins[b].box = aabb_merge(bins[b].box, part.box);
+		b++;
+	}
+}
+
+/*
+** Best spatial split: equal bins over the node bounds on each axis.
+*/
+static void	spatial_split(t_sbvh *s, t_sbvh_ref *refs, int count,
+		t_sbvh_split *best)
+{
+	t_sbvh_bin		bins[SBVH_BINS];
+	t_sbvh_split	cand;
+	int				i;
+
+	cand.spatial = 1;
+	cand.axis = 0;
+	while (cand.axis < 3)
+	{
+		cand.lo = sbvh_axis(s->bounds.min, cand.axis);
+		cand.width = (sbvh_axis(s->bounds.max, cand.axis) - cand.lo)
+			/ SBVH_BINS;
+		if (cand.width > 0)
+		{
+			sbvh_bins_clear(bins);
+			i = 0;
+			while (i < count)
+			{
+				bin_ref(s, &refs[i], &cand, bins);
+				i++;
+			}
+			sbvh_sweep(bins, &cand, best);
+		}
+		cand.axis++;
+	}
+}
+
+/*
+** Surface area of the region two boxes share, 0 if they are disjoint.
+*/
+static t_real	overlap_area(t_aabb a, t_aabb b)
+{
+	t_aabb	o;
+
+	o.min = (t_vec3){fmax(a.min.x, b.min.x), fmax(a.min.y, b.min.y),
+		fmax(a.min.z, b.min.z)};
+	o.max = (t_vec3){fmin(a.max.x, b.max.x), fmin(a.max.y, b.max.y),
+		fmin(a.max.z, b.max.z)};
+	if (o.min.x > o.max.x || o.min.y > o.max.y || o.min.z > o.max.z)
+		return (0.0);
+	return (aabb_surface_area(o));
+}
+
+/**
+ * @brief sbvh choose split 함수 - 노드의 최선 분할 선택
+ *
+ * 객체 분할을 먼저 구하고, 두 자식이 루트 면적의 SBVH_ALPHA보다 많이
+ * 겹치며 중복 예산이 남았을 때만 공간 분할을 찾아 더 싼 쪽을 고른다.
+ *
+ * @param s 빌드 상태 (bounds: 노드 경계 상자)
+ * @param refs 노드의 참조
+ * @param count 참조 수
+ * @param best 결과 분할 (분할이 없으면 cost가 INFINITY)
+ */
+void	sbvh_choose_split(t_sbvh *s, t_sbvh_ref *refs, int count,
+		t_sbvh_split *best)
+{
+	sbvh_object_split(refs, count, best);
+	if (s->budget <= 0)
+		return ;
+	if (best->cost == INFINITY
+		|| overlap_area(best->side[0], best->side[1])
+		> (t_real)SBVH_ALPHA * s->root_area)
+		spatial_split(s, refs, count, best);
+}
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_sbvh_sweep.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/06 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/06 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include <math.h>
+
+/**
+ * @brief sbvh bins clear 함수 - 빈 SAH 구간 준비
+ *
+ * @param bins SBVH_BINS개의 구간
+ */
+void	sbvh_bins_clear(t_sbvh_bin *bins)
+{
+	int	b;
+
+	b = 0;
+	while (b < SBVH_BINS)
+	{
+		bins[b].box.min = (t_vec3){INFINITY, INFINITY, INFINITY};
+		bins[b].box.max = (t_vec3){-INFINITY, -INFINITY, -INFINITY};
+		bins[b].enter = 0;
+		bins[b].exit = 0;
+		b++;
+	}
+}
+
+/**
+ * @brief sbvh bin 함수 - 분할 축 좌표가 속한 구간
+ *
+ * @param split 구간 시작(lo)과 폭(width)
+ * @param v 분할 축 좌표
+ *
+ * @return int 0 .. SBVH_BINS - 1
+ */
+int	sbvh_bin(t_sbvh_split *split, t_real v)
+{
+	int	b;
+
+	b = (int)((v - split->lo) / split->width);
+	if (b < 0)
+		return (0);
+	if (b >= SBVH_BINS)
+		return (SBVH_BINS - 1);
+	return (b);
+}
+
+/*
+** Bounds and reference counts of bins b .. SBVH_BINS - 1, for every b.
+*/
+static void	sweep_right(t_sbvh_bin *bins, t_aabb *box, int *count)
+{
+	int	b;
+
+	b = SBVH_BINS - 1;
+	box[b] = bins[b].box;
+	count[b] = bins[b].exit;
+	while (b > 0)
+	{
+		b--;
+		box[b] = aabb_merge(bins[b].box, box[b + 1]);
+		count[b] = bins[b].exit + count[b + 1];
+	}
+}
+
+/**
+ * @brief sbvh sweep 함수 - 구간 경계마다 SAH 비용 계산
+ *
+ * 왼쪽은 구간에서 시작하는 참조, 오른쪽은 구간에서 끝나는 참조를
+ * 센다. 객체 분할은 두 값이 같고, 공간 분할은 평면에 걸친 참조가
+ * 양쪽에 모두 들어간다. cand보다 싼 경계가 있으면 best에 남긴다.
+ *
+ * @param bins 채워진 구간
+ * @param cand 축, lo, width, spatial이 정해진 후보
+ * @param best 지금까지의 최선 (cost가 비교 기준)
+ */
+void	sbvh_sweep(t_sbvh_bin *bins, t_sbvh_split *cand, t_sbvh_split *best)
+{
+	t_aabb	right[SBVH_BINS];
+	int		right_count[SBVH_BINS];
+	t_aabb	left;
+	int		left_count;
+
+	sweep_right(bins, right, right_count);
+	left = bins[0].box;
+	left_count = bins[0].enter;
+	cand->plane = 1;
+	while (cand->plane < SBVH_BINS)
+	{
+		cand->cost = aabb_surface_area(left) * left_count
+			+ aabb_surface_area(right[cand->plane]) * right_count[cand->plane];
+		cand->side[0] = left;
+		cand->side[1] = right[cand->plane];
+		cand->count[0] = left_count;
+		cand->count[1] = right_count[cand->plane];
+		if (left_count > 0 && cand->count[1] > 0 && cand->cost < best->cost)
+			*best = *cand;
+		left = aabb_merge(left, bins[cand->plane].box);
+		left_count += bins[cand->plane].enter;
+		cand->plane++;
+	}
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_tile_cull.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/03 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/03 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include <math.h>
+
+/*
+** True if child box c lies entirely outside one side plane: its corner
+** farthest along the inward normal is still behind the plane. Boxes of
+** unbounded size give NaN or INFINITY and are kept.
+*/
+static int	slot_outside(t_frustum *f, t_bvh_wide *node, int c)
+{
+	t_aabb	box;
+	t_vec3	p;
+	int		k;
+
+	box = bvh_wide_box(node, c);
+	k = 0;
+	while (k < 4)
+	{
+		p = box.min;
+		if (f->normal[k].x > 0)
+			p.x = box.max.x;
+		if (f->normal[k].y > 0)
+			p.y = box.max.y;
+		if (f->normal[k].z > 0)
+			p.z = box.max.z;
+		if (vec3_dot(f->normal[k], vec3_subtract(p, f->origin)) < -EPSILON)
+			return (1);
+		k++;
+	}
+	return (0);
+}
+
+/*
+** Copy child slot c of src into slot i of dst (re-encoded in the frame
+** of dst when boxes are quantized).
+*/
+static void	copy_slot(t_bvh_wide *dst, int i, t_bvh_wide *src, int c)
+{
+	bvh_wide_slot_box(dst, i, bvh_wide_box(src, c));
+	dst->child[i] = src->child[c];
+	dst->count[i] = src->count[c];
+}
+
+/*
+** Replace inner slot i of the tile root with the children of its node
+** that are not culled, if they fit. Returns 1 if the slot was replaced.
+*/
+static int	expand_slot(t_bvh *bvh, t_frustum *f, t_bvh_wide *root, int i)
+{
+	t_bvh_wide	*node;
+	int			keep[BVH_WIDE_MAX];
+	int			k;
+	int			c;
+
+	node = &bvh->wide[root->child[i]];
+	k = 0;
+	c = 0;
+	while (c < node->n)
+	{
+		keep[k] = c;
+		k += !slot_outside(f, node, c);
+		c++;
+	}
+	if (root->n - 1 + k > BVH_WIDE_MAX)
+		return (0);
+	root->n--;
+	copy_slot(root, i, root, root->n);
+	while (k > 0)
+	{
+		k--;
+		copy_slot(root, root->n, node, keep[k]);
+		root->n++;
+	}
+	return (1);
+}
+
+/**
+ * @brief bvh tile root 함수 - 타일 절두체로 컬링한 시작 노드
+ *
+ * BVH 루트에서 시작해 절두체 밖의 자식을 버리고, 슬롯이 남는 동안
+ * 내부 자식을 그 자식들로 펼친다. 타일의 주 광선은 이 노드에서
+ * 탐색을 시작하므로 상위 트리의 상자 검사를 건너뛴다.
+ *
+ * @param bvh 넓은 노드가 만들어진 BVH
+ * @param f 타일 절두체
+ * @param root 출력 넓은 노드 (자식은 bvh의 노드와 객체를 가리킨다)
+ */
+void	bvh_tile_root(t_bvh *bvh, t_frustum *f, t_bvh_wide *root)
+{
+	int	i;
+
+	bvh_wide_frame(root, &bvh->wide_bounds, 1);
+	bvh_wide_slot_box(root, 0, bvh->root->bounds);
+	root->n = !slot_outside(f, root, 0);
+	i = 0;
+	while (i < root->n)
+	{
+		if (root->count[i] > 0 || !expand_slot(bvh, f, root, i))
+			i++;
+	}
+	i = root->n;
+	while (i < BVH_WIDE_MAX)
+	{
+		bvh_wide_slot_box(root, i, (t_aabb){{INFINITY, INFINITY, INFINITY},
+			{-INFINITY, -INFINITY, -INFINITY}});
+		i++;
+	}
+}
@@ -18,16 +18,7 @@
 static int	intersect_object(t_object_ref ref, t_ray ray, t_hit_record *hit,
 		void *scene_ptr)
 {
-	t_scene	*scene;
-
-	scene = (t_scene *)scene_ptr;
-	if (ref.type == OBJ_SPHERE)
-		return (intersect_sphere(&ray, &scene->spheres[ref.index], hit));
-	else if (ref.type == OBJ_PLANE)
-		return (intersect_plane(&ray, &scene->planes[ref.index], hit));
-	else if (ref.type == OBJ_CYLINDER)
-		return (intersect_cylinder(&ray, &scene->cylinders[ref.index], hit));
-	return (0);
+	return (intersect_scene_object((t_scene *)scene_ptr, ref, &ray, hit));
 }
 
 static int	bvh_leaf_intersect(t_bvh_node *node, t_ray ray, t_hit_record *hit,
@@ -41,10 +32,13 @@ static int	bvh_leaf_intersect(t_bvh_node *node, t_ray ray, t_hit_record *hit,
 	i = 0;
 	while (i < node->object_count)
 	{
+		temp_hit.distance = INFINITY;
 		if (intersect_object(node->objects[i], ray, &temp_hit, scene))
 		{
 			if (!hit_anything || temp_hit.distance < hit->distance)
 			{
+				temp_hit.obj_type = node->objects[i].type;
+				temp_hit.obj_index = node->objects[i].index;
 				*hit = temp_hit;
 				hit_anything = 1;
 			}
@@ -87,15 +81,15 @@ static int	check_child_hits(t_hit_check *hc)
 int	bvh_node_intersect(t_bvh_node *node, t_ray ray, t_hit_record *hit,
 		void *scene)
 {
-	double			t_min;
-	double			t_max;
+	t_real			t_min;
+	t_real			t_max;
 	t_hit_record	left_hit;
 	t_hit_record	right_hit;
 	t_hit_check		hc;
 
 	if (!node)
 		return (0);
-	t_min = 0.001;
+	t_min = HIT_EPSILON;
 	t_max = 1000000.0;
 	if (!aabb_intersect(node->bounds, ray, &t_min, &t_max))
 		return (0);
@@ -112,6 +106,8 @@ int	bvh_node_intersect(t_bvh_node *node, t_ray ray, t_hit_record *hit,
 /**
  * @brief bvh intersect 함수 - 교차 검사 수행
  *
+ * 폭이 4 또는 8이고 넓은 노드가 만들어져 있으면 넓은 BVH를 탐색한다.
+ *
  * @param bvh 파라미터
  * @param ray 파라미터
  * @param hit 파라미터
@@ -123,5 +119,7 @@ int	bvh_intersect(t_bvh *bvh, t_ray ray, t_hit_record *hit, void *scene)
 {
 	if (!bvh || !bvh->root || !bvh->enabled)
 		return (0);
+	if (bvh->width > 2 && bvh->wide)
+		return (bvh_wide_intersect(bvh, ray, hit, scene));
 	return (bvh_node_intersect(bvh->root, ray, hit, scene));
 }
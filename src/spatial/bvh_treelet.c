@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_treelet.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/04 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/04 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+
+static int	is_inner(t_bvh_node *node)
+{
+	return (node->left && node->right);
+}
+
+/*
+** Treelet leaf with the largest surface area that can still be opened
+** (an inner node), -1 if all are BVH leaves.
+*/
+static int	widest_leaf(t_treelet *t)
+{
+	int	best;
+	int	i;
+
+	best = -1;
+	i = 0;
+	while (i < t->leaves)
+	{
+		if (is_inner(t->leaf[i]) && (best < 0
+				|| aabb_surface_area(t->leaf[i]->bounds)
+				> aabb_surface_area(t->leaf[best]->bounds)))
+			best = i;
+		i++;
+	}
+	return (best);
+}
+
+/*
+** Grow the treelet under root by opening its widest leaf until it has
+** TREELET_LEAVES leaves. Returns the current inner area sum.
+*/
+static t_real	treelet_form(t_treelet *t, t_bvh_node *root)
+{
+	t_bvh_node	*node;
+	t_real		area;
+	int			best;
+
+	t->inner[0] = root;
+	t->inners = 1;
+	t->leaf[0] = root->left;
+	t->leaf[1] = root->right;
+	t->leaves = 2;
+	area = aabb_surface_area(root->bounds);
+	best = widest_leaf(t);
+	while (t->leaves < TREELET_LEAVES && best >= 0)
+	{
+		node = t->leaf[best];
+		area += aabb_surface_area(node->bounds);
+		t->inner[t->inners++] = node;
+		t->leaf[best] = node->left;
+		t->leaf[t->leaves++] = node->right;
+		best = widest_leaf(t);
+	}
+	return (area);
+}
+
+/*
+** Depths below node after the treelets above were rebuilt.
+*/
+static void	set_depth(t_bvh_node *node, int depth)
+{
+	if (!node)
+		return ;
+	node->depth = depth;
+	set_depth(node->left, depth + 1);
+	set_depth(node->right, depth + 1);
+}
+
+/**
+ * @brief bvh treelet optimize 함수 - 트리릿 재구성으로 SAH 비용 감소
+ *
+ * 아래에서 위로 각 내부 노드에 잎 TREELET_LEAVES개짜리 트리릿을 만들고,
+ * 잎 부분집합에 대한 동적 계획법으로 내부 노드 표면적 합이 가장 작은
+ * 위상을 찾는다. 더 나을 때만 내부 노드를 다시 연결한다.
+ *
+ * @param node 부분 트리 루트
+ */
+void	bvh_treelet_optimize(t_bvh_node *node)
+{
+	t_treelet	t;
+	t_real		area;
+	int			depth;
+
+	if (!node || !is_inner(node))
+		return ;
+	bvh_treelet_optimize(node->left);
+	bvh_treelet_optimize(node->right);
+	area = treelet_form(&t, node);
+	if (t.leaves < 3 || treelet_optimize(&t) >= area)
+		return ;
+	depth = node->depth;
+	treelet_rebuild(&t);
+	set_depth(node, depth);
+}
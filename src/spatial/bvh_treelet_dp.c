@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_treelet_dp.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/04 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/04 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+
+/*
+** Bounds of every leaf subset, built from the subset without its lowest
+** leaf.
+*/
+static void	treelet_boxes(t_treelet *t)
+{
+	int	s;
+	int	low;
+
+	s = 1;
+	while (s < (1 << t->leaves))
+	{
+		low = s & -s;
+		if (s == low)
+			t->box[s] = t->leaf[__builtin_ctz(s)]->bounds;
+		else
+			t->box[s] = aabb_merge(t->box[s ^ low], t->box[low]);
+		s++;
+	}
+}
+
+/*
+** Cheapest split of subset s into two parts (the part holding the
+** lowest leaf is stored; the other is s ^ split). Smaller subsets are
+** already solved because they come first in numeric order.
+*/
+static void	best_split(t_treelet *t, int s)
+{
+	int		part;
+	t_real	cost;
+
+	t->cost[s] = 0;
+	t->split[s] = 0;
+	if (s == (s & -s))
+		return ;
+	part = (s - 1) & s;
+	while (part)
+	{
+		cost = t->cost[part] + t->cost[s ^ part];
+		if ((part & s & -s) && (!t->split[s] || cost < t->cost[s]))
+		{
+			t->cost[s] = cost;
+			t->split[s] = part;
+		}
+		part = (part - 1) & s;
+	}
+	t->cost[s] += aabb_surface_area(t->box[s]);
+}
+
+/**
+ * @brief treelet optimize 함수 - 최적 트리릿 위상의 비용
+ *
+ * 잎 부분 트리의 비용은 위상과 무관하므로 내부 노드 표면적 합만
+ * 비교한다.
+ *
+ * @param t 트리릿
+ *
+ * @return t_real 전체 잎 집합의 최소 내부 표면적 합
+ */
+t_real	treelet_optimize(t_treelet *t)
+{
+	int	s;
+
+	treelet_boxes(t);
+	s = 1;
+	while (s < (1 << t->leaves))
+		best_split(t, s++);
+	return (t->cost[(1 << t->leaves) - 1]);
+}
+
+static t_bvh_node	*rebuild_set(t_treelet *t, int s, int *used)
+{
+	t_bvh_node	*node;
+
+	if (s == (s & -s))
+		return (t->leaf[__builtin_ctz(s)]);
+	node = t->inner[(*used)++];
+	node->left = rebuild_set(t, t->split[s], used);
+	node->right = rebuild_set(t, s ^ t->split[s], used);
+	node->bounds = t->box[s];
+	return (node);
+}
+
+/**
+ * @brief treelet rebuild 함수 - 최적 위상으로 내부 노드 재연결
+ *
+ * 루트는 inner[0]을 그대로 쓰므로 부모의 포인터는 바뀌지 않는다.
+ *
+ * @param t treelet_optimize를 마친 트리릿
+ */
+void	treelet_rebuild(t_treelet *t)
+{
+	int	used;
+
+	used = 0;
+	rebuild_set(t, (1 << t->leaves) - 1, &used);
+}
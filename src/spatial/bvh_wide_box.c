@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_wide_box.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/07 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/07 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+
+/*
+** Child boxes stored as t_real (default layout). The quantized layout
+** (make QBVH=1) is in bvh_qwide.c.
+*/
+#ifndef MINIRT_QBVH
+
+/**
+ * @brief bvh wide frame 함수 - 노드의 양자화 기준 틀 설정
+ *
+ * 실수 상자를 그대로 저장하는 배치에서는 할 일이 없다.
+ *
+ * @param w 넓은 노드
+ * @param boxes 자식 상자
+ * @param n 자식 수
+ */
+void	bvh_wide_frame(t_bvh_wide *w, t_aabb *boxes, int n)
+{
+	(void)w;
+	(void)boxes;
+	(void)n;
+}
+
+/**
+ * @brief bvh wide slot box 함수 - SoA 슬롯 i에 자식 상자 저장
+ *
+ * 자식 인덱스와 객체 수는 0으로 초기화한다 (내부 자식).
+ *
+ * @param w 넓은 노드
+ * @param i 슬롯
+ * @param box 자식 상자 (빈 슬롯은 min = INFINITY, max = -INFINITY)
+ */
+void	bvh_wide_slot_box(t_bvh_wide *w, int i, t_aabb box)
+{
+	w->bmin[0][i] = box.min.x;
+	w->bmin[1][i] = box.min.y;
+	w->bmin[2][i] = box.min.z;
+	w->bmax[0][i] = box.max.x;
+	w->bmax[1][i] = box.max.y;
+	w->bmax[2][i] = box.max.z;
+	w->child[i] = 0;
+	w->count[i] = 0;
+}
+
+/**
+ * @brief bvh wide box 함수 - 슬롯 i의 자식 상자
+ *
+ * @param w 넓은 노드
+ * @param i 슬롯
+ *
+ * @return t_aabb 자식 상자
+ */
+t_aabb	bvh_wide_box(t_bvh_wide *w, int i)
+{
+	t_aabb	box;
+
+	box.min = (t_vec3){w->bmin[0][i], w->bmin[1][i], w->bmin[2][i]};
+	box.max = (t_vec3){w->bmax[0][i], w->bmax[1][i], w->bmax[2][i]};
+	return (box);
+}
+
+#endif
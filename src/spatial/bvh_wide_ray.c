@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_wide_ray.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/02 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/02 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include <math.h>
+
+/**
+ * @brief bvh wide ray init 함수 - 슬랩 검사용 광선 준비
+ *
+ * @param wr 출력: 원점과 방향의 역수
+ * @param ray 파라미터
+ */
+void	bvh_wide_ray_init(t_wide_ray *wr, t_ray *ray)
+{
+	wr->org[0] = ray->origin.x;
+	wr->org[1] = ray->origin.y;
+	wr->org[2] = ray->origin.z;
+	wr->inv[0] = 1 / ray->direction.x;
+	wr->inv[1] = 1 / ray->direction.y;
+	wr->inv[2] = 1 / ray->direction.z;
+	wr->tmax = INFINITY;
+}
+
+/**
+ * @brief bvh wide order 함수 - 맞은 자식의 방문 순서
+ *
+ * 진입 거리가 유한한 (상자에 맞은) 자식의 인덱스를 진입 거리가
+ * 먼 순서로 정렬한다. 스택에 이 순서로 넣으면 가장 가까운 자식을
+ * 먼저 꺼낸다.
+ *
+ * @param tnear 자식별 진입 거리 (빗나가면 INFINITY)
+ * @param count 자식 수
+ * @param order 출력: 정렬된 자식 인덱스
+ *
+ * @return int 맞은 자식 수
+ */
+int	bvh_wide_order(t_real *tnear, int count, int *order)
+{
+	int	n;
+	int	i;
+	int	k;
+
+	n = 0;
+	i = 0;
+	while (i < count)
+	{
+		if (tnear[i] < INFINITY)
+		{
+			k = n;
+			while (k > 0 && tnear[order[k - 1]] < tnear[i])
+			{
+				order[k] = order[k - 1];
+				k--;
+			}
+			order[k] = i;
+			n++;
+		}
+		i++;
+	}
+	return (n);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_wide_slab.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/01 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/01 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include <math.h>
+
+/*
+** Slab test of every child box of a wide node against one ray.
+** tnear[i] receives the box entry distance, or INFINITY when the ray
+** misses child i or enters it beyond ray->tmax (the closest hit so far).
+** Quantized nodes (make QBVH=1) are tested in bvh_qwide_slab.c.
+*/
+#if VEC3_USE_SSE2 && !defined(MINIRT_FLOAT) && !defined(MINIRT_QBVH)
+
+/*
+** SSE2: children i and i + 1 in one register pair, three axes.
+*/
+static void	slab_pair(t_bvh_wide *node, t_wide_ray *ray, int i, t_real *tnear)
+{
+	__m128d	lo;
+	__m128d	hi;
+	__m128d	t[2];
+	int		a;
+
+	lo = _mm_setzero_pd();
+	hi = _mm_set1_pd(ray->tmax);
+	a = 0;
+	while (a < 3)
+	{
+		t[0] = _mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(&node->bmin[a][i]),
+					_mm_set1_pd(ray->org[a])), _mm_set1_pd(ray->inv[a]));
+		t[1] = _mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(&node->bmax[a][i]),
+					_mm_set1_pd(ray->org[a])), _mm_set1_pd(ray->inv[a]));
+		lo = _mm_max_pd(_mm_min_pd(t[0], t[1]), lo);
+		hi = _mm_min_pd(_mm_max_pd(t[0], t[1]), hi);
+		a++;
+	}
+	hi = _mm_cmple_pd(lo, hi);
+	lo = _mm_or_pd(_mm_and_pd(hi, lo),
+			_mm_andnot_pd(hi, _mm_set1_pd(INFINITY)));
+	_mm_storeu_pd(&tnear[i], lo);
+}
+
+void	bvh_wide_slab(t_bvh_wide *node, t_wide_ray *ray, t_real *tnear)
+{
+	int	i;
+
+	i = 0;
+	while (i < node->n)
+	{
+		slab_pair(node, ray, i, tnear);
+		i += 2;
+	}
+}
+
+#elif !defined(MINIRT_QBVH)
+
+/*
+** Scalar lanes over the SoA arrays. Plain comparisons (no fmin / fmax
+** calls) skip the NaN of a zero direction on a slab plane.
+*/
+static void	slab_axis(t_real lo, t_real hi, t_real *near, t_real *far)
+{
+	t_real	swap;
+
+	if (lo > hi)
+	{
+		swap = lo;
+		lo = hi;
+		hi = swap;
+	}
+	if (lo > *near)
+		*near = lo;
+	if (hi < *far)
+		*far = hi;
+}
+
+void	bvh_wide_slab(t_bvh_wide *node, t_wide_ray *ray, t_real *tnear)
+{
+	t_real	far;
+	int		i;
+	int		a;
+
+	i = 0;
+	while (i < node->n)
+	{
+		tnear[i] = 0;
+		far = ray->tmax;
+		a = 0;
+		while (a < 3)
+		{
+			slab_axis((node->bmin[a][i] - ray->org[a]) * ray->inv[a],
+				(node->bmax[a][i] - ray->org[a]) * ray->inv[a],
+				&tnear[i], &far);
+			a++;
+		}
+		if (tnear[i] > far)
+			tnear[i] = INFINITY;
+		i++;
+	}
+}
+
+#endif
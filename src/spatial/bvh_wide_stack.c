@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_wide_stack.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/09 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/09 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+
+/*
+** Largest number of entries the traversal stack gains below wide node idx:
+** popping a node pushes its n children, a net gain of n - 1, and the
+** siblings stay on the stack while the deepest child is visited.
+*/
+static int	stack_gain(t_bvh *bvh, int idx)
+{
+	t_bvh_wide	*w;
+	int			deepest;
+	int			gain;
+	int			i;
+
+	w = &bvh->wide[idx];
+	deepest = 0;
+	i = 0;
+	while (i < w->n)
+	{
+		if (w->count[i] == 0 && w->child[i] > idx)
+		{
+			gain = stack_gain(bvh, w->child[i]);
+			if (gain > deepest)
+				deepest = gain;
+		}
+		i++;
+	}
+	return (w->n - 1 + deepest);
+}
+
+/**
+ * @brief bvh wide stack fits 함수 - 넓은 탐색 스택 크기 확인
+ *
+ * 루트에서 잎까지 경로마다 (자식 수 - 1)을 더한 최댓값이 스택이
+ * 늘어나는 최대 크기다. 타일 루트는 BVH_WIDE_MAX개 항목으로 시작하므로
+ * 그만큼 더해 BVH_WIDE_STACK 안에 들어가는지 본다.
+ *
+ * @param bvh 넓은 노드가 만들어진 BVH
+ *
+ * @return int 들어가면 1, 아니면 0
+ */
+int	bvh_wide_stack_fits(t_bvh *bvh)
+{
+	if (!bvh->wide || bvh->wide_count == 0)
+		return (0);
+	return (BVH_WIDE_MAX + stack_gain(bvh, 0) <= BVH_WIDE_STACK);
+}
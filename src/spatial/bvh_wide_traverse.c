@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_wide_traverse.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/01 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/01 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include "minirt.h"
+#include <math.h>
+
+/*
+** Set up the traversal: origin and reciprocal direction for the slab
+** test, root on the stack. Returns 0 when the ray misses the root box.
+*/
+static int	wide_trav_init(t_wide_trav *tr, t_bvh *bvh, t_ray *ray,
+		t_hit_record *hit)
+{
+	t_real	t[2];
+
+	t[0] = HIT_EPSILON;
+	t[1] = hit->distance;
+	if (!aabb_intersect(bvh->root->bounds, *ray, &t[0], &t[1]))
+		return (0);
+	tr->bvh = bvh;
+	tr->lane_bit = 1;
+	tr->ray = *ray;
+	tr->hit = hit;
+	bvh_wide_ray_init(&tr->wr, ray);
+	tr->stack[0] = (t_wide_entry){0, 0, t[0], 1};
+	tr->size = 1;
+	return (1);
+}
+
+/*
+** Test the objects of a leaf child, keeping the closest hit. Objects the
+** ray already tested in another leaf (SBVH duplicates) are skipped.
+*/
+static int	leaf_intersect(t_wide_trav *tr, t_wide_entry *e)
+{
+	t_hit_record	temp;
+	t_object_ref	ref;
+	int				found;
+	int				i;
+
+	found = 0;
+	i = 0;
+	while (i < e->count)
+	{
+		ref = tr->bvh->wide_refs[e->child + i];
+		temp.distance = tr->hit->distance;
+		if (bvh_mail_lanes(tr->bvh, ref, tr->lane_bit)
+			&& intersect_scene_object(tr->scene, ref, &tr->ray, &temp))
+		{
+			temp.obj_type = ref.type;
+			temp.obj_index = ref.index;
+			*tr->hit = temp;
+			found = 1;
+		}
+		i++;
+	}
+	return (found);
+}
+
+/*
+** Slab-test all children and push the hit ones farthest first, so the
+** nearest child is visited next.
+*/
+static void	push_children(t_wide_trav *tr, t_bvh_wide *node)
+{
+	t_real	tnear[BVH_WIDE_MAX];
+	int		order[BVH_WIDE_MAX];
+	int		n;
+	int		i;
+
+	bvh_wide_slab(node, &tr->wr, tnear);
+	n = bvh_wide_order(tnear, node->n, order);
+	i = 0;
+	while (i < n)
+	{
+		tr->stack[tr->size] = (t_wide_entry){node->child[order[i]],
+			node->count[order[i]], tnear[order[i]], 1};
+		tr->size++;
+		i++;
+	}
+}
+
+/*
+** Pop entries until the stack is empty, visiting the nearest child first.
+** Children farther than the current closest hit are skipped without a
+** box test. Also resumes single-lane subtrees of a packet traversal.
+*/
+int	bvh_wide_run(t_wide_trav *tr)
+{
+	t_wide_entry	e;
+	int				found;
+
+	found = 0;
+	while (tr->size > 0)
+	{
+		tr->size--;
+		e = tr->stack[tr->size];
+		if (e.t <= tr->hit->distance && e.count > 0)
+			found |= leaf_intersect(tr, &e);
+		else if (e.t <= tr->hit->distance)
+		{
+			tr->wr.tmax = tr->hit->distance;
+			push_children(tr, &tr->bvh->wide[e.child]);
+		}
+	}
+	return (found);
+}
+
+/**
+ * @brief bvh wide intersect 함수 - 넓은 BVH 탐색
+ *
+ * 루트 상자를 먼저 검사하고, 스택에서 가장 가까운 자식부터 꺼낸다.
+ * 현재 최근접 교차보다 먼 자식은 상자 검사 없이 건너뛴다.
+ *
+ * @param bvh 파라미터
+ * @param ray 파라미터
+ * @param hit 최근접 교차 (distance는 상한으로 초기화되어 있어야 함)
+ * @param scene 파라미터
+ *
+ * @return int 교차가 있으면 1
+ */
+int	bvh_wide_intersect(t_bvh *bvh, t_ray ray, t_hit_record *hit, void *scene)
+{
+	t_wide_trav	tr;
+
+	if (!wide_trav_init(&tr, bvh, &ray, hit))
+		return (0);
+	bvh_mail_next(bvh);
+	tr.scene = scene;
+	return (bvh_wide_run(&tr));
+}
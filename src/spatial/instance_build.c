@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   instance_build.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/02/08 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/02/08 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minirt.h"
+#include "window.h"
+#include "utils.h"
+#include <stdlib.h>
+#include <math.h>
+
+/*
+** Build the bottom-level BVH of one group over its member slots.
+** The members are ordinary scene objects, so bounds and hits come from
+** the same code as world objects (in group coordinates). On failure
+** instances_free() releases the BVH.
+*/
+static int	build_group(t_scene *scene, t_group *g)
+{
+	t_object_ref	*refs;
+	int				n;
+	int				i;
+
+	n = g->sphere_count + g->cylinder_count;
+	g->bvh = bvh_create();
+	if (!g->bvh)
+		return (0);
+	refs = malloc(sizeof(t_object_ref) * n);
+	if (!refs)
+		return (0);
+	i = 0;
+	while (i < n)
+	{
+		refs[i] = (t_object_ref){OBJ_SPHERE, g->first_sphere + i};
+		if (i >= g->sphere_count)
+			refs[i] = (t_object_ref){OBJ_CYLINDER,
+				g->first_cylinder + i - g->sphere_count};
+		i++;
+	}
+	bvh_build(g->bvh, refs, n, scene);
+	free(refs);
+	if (g->bvh->root)
+		g->bounds = g->bvh->root->bounds;
+	return (g->bvh->root != NULL);
+}
+
+/**
+ * @brief instance to world 함수 - 그룹 공간 점을 월드 좌표로 변환
+ *
+ * @param inst 인스턴스
+ * @param p 그룹 공간 점
+ *
+ * @return t_vec3 월드 좌표
+ */
+t_vec3	instance_to_world(t_instance *inst, t_vec3 p)
+{
+	t_vec3	w;
+
+	w = vec3_add(vec3_multiply(inst->basis[0], p.x),
+			vec3_add(vec3_multiply(inst->basis[1], p.y),
+				vec3_multiply(inst->basis[2], p.z)));
+	return (vec3_add(inst->position, vec3_multiply(w, inst->scale)));
+}
+
+/*
+** World box of the 8 transformed group box corners, and the bounding
+** sphere of the group box (center and half diagonal).
+*/
+static void	place_instance(t_instance *inst, t_aabb box)
+{
+	t_vec3	e[2];
+	t_vec3	p;
+	int		i;
+
+	e[0] = box.min;
+	e[1] = box.max;
+	inst->bounds = (t_aabb){{INFINITY, INFINITY, INFINITY},
+	{-INFINITY, -INFINITY, -INFINITY}};
+	i = 0;
+	while (i < 8)
+	{
+		p = instance_to_world(inst, (t_vec3){e[i & 1].x,
+				e[(i >> 1) & 1].y, e[(i >> 2) & 1].z});
+		inst->bounds = aabb_merge(inst->bounds, (t_aabb){p, p});
+		i++;
+	}
+	inst->center = instance_to_world(inst,
+			vec3_multiply(vec3_add(box.min, box.max), 0.5));
+	inst->radius = inst->scale / 2
+		* vec3_magnitude(vec3_subtract(box.max, box.min));
+}
+
+/**
+ * @brief instances build 함수 - 그룹 BVH와 인스턴스 경계 계산
+ *
+ * 그룹마다 하위 BVH를 한 번 만들고, 인스턴스는 변환된 그룹 경계만
+ * 가진다. 인스턴스는 장면 BVH의 참조 하나가 된다 (2단계 BVH).
+ *
+ * @param scene 파라미터
+ *
+ * @return int 성공 1, 메모리 부족이면 0
+ */
+int	instances_build(t_scene *scene)
+{
+	int	i;
+
+	i = 0;
+	while (i < scene->group_count)
+	{
+		if (!build_group(scene, &scene->groups[i]))
+			return (print_error("Failed to build group BVH"));
+		i++;
+	}
+	i = 0;
+	while (i < scene->instance_count)
+	{
+		place_instance(&scene->instances[i],
+			scene->groups[scene->instances[i].group].bounds);
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * @brief instances free 함수 - 그룹 BVH와 인스턴스 배열 해제
+ *
+ * @param scene 파라미터
+ */
+void	instances_free(t_scene *scene)
+{
+	int	i;
+
+	i = 0;
+	while (i < scene->group_count)
+	{
+		bvh_destroy(scene->groups[i].bvh);
+		scene->groups[i].bvh = NULL;
+		i++;
+	}
+	free(scene->instances);
+	scene->instances = NULL;
+	scene->instance_count = 0;
+	scene->instance_capacity = 0;
+}
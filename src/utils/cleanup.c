@@ -28,12 +28,14 @@ void	cleanup_scene(t_scene *scene)
 	if (!scene)
 		return ;
 	render_state_cleanup(&scene->render_state);
+	instances_free(scene);
+	meshes_free(scene);
 	free(scene);
 }
 
 /*
 ** Free memory allocated for render context.
-** Destroys MLX image buffer and frees render structure.
+** Destroys MLX image buffers and frees render structure.
 */
 /**
  * @brief cleanup render 함수 - 정리 수행
@@ -49,6 +51,11 @@ void	cleanup_render(void *param)
 		return ;
 	if (render->img && render->mlx)
 		mlx_destroy_image(render->mlx, render->img);
+	if (render->view_img && render->mlx)
+		mlx_destroy_image(render->mlx, render->view_img);
+	free(render->pick_ids);
+	reproject_free(&render->reproj);
+	frame_cache_free(&render->frame_cache);
 	free(render);
 }
 
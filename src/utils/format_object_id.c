@@ -21,6 +21,10 @@ char	*get_object_type_prefix(t_obj_type type)
 		return ("pl");
 	else if (type == OBJ_CYLINDER)
 		return ("cy");
+	else if (type == OBJ_INSTANCE)
+		return ("in");
+	else if (type == OBJ_MESH)
+		return ("mh");
 	return ("??");
 }
 
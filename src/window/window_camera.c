@@ -13,7 +13,7 @@
 #include "minirt.h"
 #include "window.h"
 #include "window_internal.h"
-#include <math.h>
+#include <tgmath.h>
 
 /*
 ** Handle camera movement based on WASDQZ keys.
@@ -29,7 +29,7 @@ void	handle_camera_move(t_render *render, int keycode)
 {
 	t_vec3	right;
 	t_vec3	move;
-	double	step;
+	t_real	step;
 
 	step = 1.0;
 	right = vec3_normalize(vec3_cross(render->scene->camera.direction,
@@ -66,9 +66,9 @@ void	handle_camera_pitch(t_render *render, int keycode)
 {
 	t_vec3	right;
 	t_vec3	new_dir;
-	double	angle;
-	double	cos_a;
-	double	sin_a;
+	t_real	angle;
+	t_real	cos_a;
+	t_real	sin_a;
 
 	angle = 5.0 * M_PI / 180.0;
 	if (keycode == KEY_C)
@@ -13,6 +13,7 @@
 #include "minirt.h"
 #include "window.h"
 #include "window_internal.h"
+#include "hud.h"
 
 /*
 ** Check if key is a movement or transformation key.
@@ -35,6 +36,32 @@ static int	is_movement_key(int keycode)
 		|| keycode == KEY_DELETE || keycode == KEY_END || keycode == KEY_PGDN);
 }
 
+/*
+** Cycle the BVH node width (binary, BVH4, BVH8) and re-render the frame
+** so its time shows on the HUD. The image itself does not change.
+*/
+/**
+ * @brief cycle bvh width 함수
+ *
+ * @param render 파라미터
+ */
+static void	cycle_bvh_width(t_render *render)
+{
+	t_bvh	*bvh;
+	int		width;
+
+	bvh = render->scene->render_state.bvh;
+	if (!bvh)
+		return ;
+	width = bvh->width * 2;
+	if (width > BVH_WIDE_MAX)
+		width = 2;
+	bvh_set_width(bvh, width);
+	damage_mark_full(&render->damage);
+	render->dirty = 1;
+	hud_mark_dirty(render);
+}
+
 /*
 ** Handle keyboard input events with interactive controls.
 ** Uses dirty flag and low quality rendering for smooth interaction.
@@ -52,6 +79,8 @@ int	handle_key(int keycode, void *param)
 	t_render	*render;
 
 	render = (t_render *)param;
+	if (handle_jump_key(render, keycode))
+		return (0);
 	if (keycode == KEY_ESC)
 		close_window(param);
 	handle_hud_keys(render, keycode);
@@ -61,8 +90,11 @@ int	handle_key(int keycode, void *param)
 	{
 		render->scene->render_state.show_info
 			= !render->scene->render_state.show_info;
+		damage_mark_full(&render->damage);
 		render->dirty = 1;
 	}
+	else if (keycode == KEY_N)
+		cycle_bvh_width(render);
 	else if (keycode == KEY_SHIFT_L || keycode == KEY_SHIFT_R)
 		render->shift_pressed = 1;
 	handle_camera_keys(render, keycode);
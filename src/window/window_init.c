@@ -15,6 +15,7 @@
 #include "hud.h"
 #include "keyguide.h"
 #include "pixel_timing.h"
+#include "utils.h"
 #include <stdlib.h>
 
 /*
@@ -37,6 +38,9 @@ static void	init_render_state(t_render *render, t_scene *scene)
 	render->shift_pressed = 0;
 	pixel_timing_init(&render->pixel_timing);
 	debounce_init(&render->debounce);
+	damage_reset(&render->damage);
+	damage_mark_full(&render->damage);
+	frame_cache_init(&render->frame_cache);
 }
 
 /*
@@ -55,16 +59,22 @@ static int	init_ui_components(t_render *render, t_scene *scene)
 {
 	if (hud_init(&render->hud, render->mlx, render->win) == -1)
 	{
+		free(render->pick_ids);
+		reproject_free(&render->reproj);
 		free(render);
 		return (-1);
 	}
 	if (keyguide_init(&render->keyguide, render->mlx, render->win) == -1)
 	{
 		hud_cleanup(&render->hud, render->mlx);
+		free(render->pick_ids);
+		reproject_free(&render->reproj);
 		free(render);
 		return (-1);
 	}
-	render->hud.total_pages = hud_calculate_total_pages(scene);
+	keyguide_render(render);
+	hud_index_build(&render->hud.index, scene);
+	render->hud.total_pages = hud_calculate_total_pages(&render->hud.index);
 	return (0);
 }
 
@@ -81,11 +91,15 @@ static void	register_hooks(t_render *render)
 	mlx_hook(render->win, 17, 0, close_window, render);
 	mlx_hook(render->win, 2, 1L << 0, handle_key, render);
 	mlx_hook(render->win, 3, 1L << 1, handle_key_release, render);
+	mlx_mouse_hook(render->win, handle_mouse, render);
 	mlx_loop_hook(render->mlx, render_loop, render);
 }
 
 /*
-** Initialize MLX connection and image buffer.
+** Initialize MLX connection, scene image and composited view image.
+** The pick and reprojection buffers are optional: if they cannot be
+** allocated, rendering works as before and mouse picking or camera
+** reprojection is disabled.
 ** Returns 0 on success, -1 on failure.
 */
 /**
@@ -103,10 +117,20 @@ static int	init_mlx(t_render *render)
 	render->win = mlx_new_window(render->mlx, WINDOW_WIDTH,
 			WINDOW_HEIGHT, "miniRT");
 	render->img = mlx_new_image(render->mlx, WINDOW_WIDTH, WINDOW_HEIGHT);
-	if (!render->win || !render->img)
+	render->view_img = mlx_new_image(render->mlx, WINDOW_WIDTH,
+			WINDOW_HEIGHT);
+	if (!render->win || !render->img || !render->view_img)
 		return (-1);
 	render->img_data = mlx_get_data_addr(render->img, &render->bpp,
 			&render->size_line, &render->endian);
+	render->view_data = mlx_get_data_addr(render->view_img, &render->bpp,
+			&render->size_line, &render->endian);
+	render->view_valid = 0;
+	render->pick_ids = malloc(sizeof(int) * WINDOW_WIDTH * WINDOW_HEIGHT);
+	if (render->pick_ids)
+		ft_memset(render->pick_ids, 0xFF,
+			sizeof(int) * WINDOW_WIDTH * WINDOW_HEIGHT);
+	reproject_init(&render->reproj);
 	return (0);
 }
 
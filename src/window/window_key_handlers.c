@@ -15,8 +15,39 @@
 #include "window_internal.h"
 #include "hud.h"
 
+/*
+** Common tail of camera and light changes. A view seen before comes
+** straight from the frame cache and needs no render; otherwise every
+** pixel changes, so the whole frame is damaged and a debounced render
+** is scheduled. Small camera steps first show the previous frame
+** reprojected, which that render then refines.
+*/
+/**
+ * @brief view changed 함수 - 카메라/광원 변경 처리
+ *
+ * @param render 파라미터
+ * @param reproject 재투영 프레임을 바로 보여줄지 여부
+ */
+static void	view_changed(t_render *render, int reproject)
+{
+	hud_mark_dirty(render);
+	if (frame_cache_restore(&render->frame_cache, render))
+	{
+		debounce_timer_stop(&render->debounce.timer);
+		render->debounce.state = DEBOUNCE_IDLE;
+		render->low_quality = 0;
+		render->dirty = 0;
+		return ;
+	}
+	damage_mark_full(&render->damage);
+	if (reproject)
+		reproject_frame(render);
+	debounce_on_input(&render->debounce, render);
+}
+
 /*
 ** Handle camera-related keys and mark dirty for low quality render.
+** Move and pitch steps are small enough to reproject; reset is not.
 */
 /**
  * @brief handle camera keys 함수
@@ -28,27 +59,20 @@ void	handle_camera_keys(t_render *render, int keycode)
 {
 	if (keycode == KEY_W || keycode == KEY_X || keycode == KEY_A
 		|| keycode == KEY_D || keycode == KEY_Q || keycode == KEY_Z)
-	{
 		handle_camera_move(render, keycode);
-		debounce_on_input(&render->debounce, render);
-		hud_mark_dirty(render);
-	}
 	else if (keycode == KEY_E || keycode == KEY_C)
-	{
 		handle_camera_pitch(render, keycode);
-		debounce_on_input(&render->debounce, render);
-		hud_mark_dirty(render);
-	}
 	else if (keycode == KEY_S)
-	{
 		handle_camera_reset(render);
-		debounce_on_input(&render->debounce, render);
-		hud_mark_dirty(render);
-	}
+	else
+		return ;
+	view_changed(render, keycode != KEY_S);
 }
 
 /*
 ** Handle object and light movement keys.
+** Object moves record their own screen damage; light moves change
+** shading everywhere.
 */
 /**
  * @brief handle transform keys 함수
@@ -70,8 +94,7 @@ void	handle_transform_keys(t_render *render, int keycode)
 		|| keycode == KEY_END || keycode == KEY_PGDN)
 	{
 		handle_light_move(render, keycode);
-		debounce_on_input(&render->debounce, render);
-		hud_mark_dirty(render);
+		view_changed(render, 0);
 	}
 }
 
@@ -99,4 +122,6 @@ void	handle_hud_keys(t_render *render, int keycode)
 		hud_change_page(render, -1);
 	else if (keycode == KEY_DOWN)
 		hud_change_page(render, 1);
+	else if (keycode == KEY_J)
+		handle_jump_start(render);
 }
@@ -18,12 +18,41 @@
 #include "metrics.h"
 
 /*
-** Main rendering loop hook.
-** Only re-renders when dirty flag is set.
+** Render one scene frame into the scene image.
+** Returns 1 if a complete frame was produced, 0 if it was cancelled.
+** Damage is kept until a full-quality frame has re-traced it; such a
+** frame is also kept in the frame cache.
 */
+static int	render_frame(t_render *render)
+{
+	render->is_rendering = 1;
+	metrics_start_frame(&render->scene->render_state.metrics);
+	render_scene_to_buffer(render->scene, render);
+	render->is_rendering = 0;
+	reproject_frame_done(&render->reproj, &render->scene->camera,
+		!render->debounce.cancel_requested, render->low_quality);
+	if (render->debounce.cancel_requested)
+	{
+		debounce_cancel(&render->debounce);
+		render->dirty = 1;
+		return (0);
+	}
+	metrics_end_frame(&render->scene->render_state.metrics);
+	if (!render->low_quality)
+	{
+		damage_reset(&render->damage);
+		frame_cache_store(&render->frame_cache, render);
+	}
+	render->view_valid = 0;
+	render->dirty = 0;
+	return (1);
+}
+
 /*
 ** Main rendering loop hook.
-** Only re-renders when dirty flag is set.
+** Only re-renders when dirty flag is set. HUD text is drawn into its
+** layer first, then the whole frame goes out in one image put; the
+** refresh time is kept in the frame metrics (shown in the HUD).
 */
 /**
  * @brief render loop 함수 - 렌더링 수행
@@ -34,38 +63,23 @@
  */
 int	render_loop(void *param)
 {
-	t_render	*render;
-	int			rendered;
+	t_render		*render;
+	int				rendered;
+	struct timeval	hud_start;
 
 	render = (t_render *)param;
 	rendered = 0;
 	debounce_update(&render->debounce, render);
 	if (render->dirty)
+		rendered = render_frame(render);
+	if (rendered || render->hud.dirty)
 	{
-		render->is_rendering = 1;
-		metrics_start_frame(&render->scene->render_state.metrics);
-		render_scene_to_buffer(render->scene, render);
-		render->is_rendering = 0;
-		if (render->debounce.cancel_requested)
-		{
-			debounce_cancel(&render->debounce);
-			render->dirty = 1;
-		}
-		else
-		{
-			metrics_end_frame(&render->scene->render_state.metrics);
-			mlx_put_image_to_window(
-				render->mlx,
-				render->win,
-				render->img, 0, 0);
-			render->dirty = 0;
-			rendered = 1;
-		}
-	}
-	if (render->hud.visible && (render->hud.dirty || rendered))
-	{
+		timer_start(&hud_start);
 		hud_render(render);
-		keyguide_render(render);
+		render_present(render);
+		render->hud.dirty = 0;
+		render->scene->render_state.metrics.hud_time_us
+			= timer_elapsed_us(&hud_start);
 	}
 	return (0);
 }
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   window_mouse.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/26 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/26 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "window.h"
+#include "window_internal.h"
+#include "hud.h"
+
+/*
+** Handle mouse clicks.
+** Left click selects the object under the cursor straight from the pick
+** buffer filled by the last frame (no ray cast, no re-render); clicking
+** the background, an instance or a mesh (not editable) clears the
+** selection.
+*/
+/**
+ * @brief handle mouse 함수
+ *
+ * @param button 마우스 버튼
+ * @param x 윈도우 x 좌표
+ * @param y 윈도우 y 좌표
+ * @param param 파라미터
+ *
+ * @return int 반환값
+ */
+int	handle_mouse(int button, int x, int y, void *param)
+{
+	t_render	*render;
+	t_selection	sel;
+	int			pick;
+
+	render = (t_render *)param;
+	if (button != MOUSE_LEFT || !render->pick_ids
+		|| x < 0 || x >= WINDOW_WIDTH || y < 0 || y >= WINDOW_HEIGHT)
+		return (0);
+	pick = render->pick_ids[y * WINDOW_WIDTH + x];
+	if (pick == PICK_NONE || (pick >> PICK_TYPE_SHIFT) > OBJ_CYLINDER)
+	{
+		render->selection.type = OBJ_NONE;
+		render->selection.index = 0;
+		hud_mark_dirty(render);
+		return (0);
+	}
+	sel.type = pick >> PICK_TYPE_SHIFT;
+	sel.index = pick & PICK_INDEX_MASK;
+	hud_select_global(render, hud_get_global_index(sel, &render->hud.index));
+	return (0);
+}
@@ -13,33 +13,60 @@
 #include "minirt.h"
 #include "window.h"
 #include "window_internal.h"
+#include "spatial.h"
 
 /*
-** Move the currently selected object by the given delta vector.
+** Position of the currently selected object, or NULL if none.
 */
 /**
- * @brief move selected object 함수
+ * @brief selected position 함수 - 선택 객체의 위치 조회
  *
  * @param render 파라미터
- * @param move 파라미터
+ *
+ * @return t_vec3* 위치 포인터 (선택 없음이면 NULL)
  */
-static void	move_selected_object(t_render *render, t_vec3 move)
+static t_vec3	*selected_position(t_render *render)
 {
 	if (render->selection.type == OBJ_SPHERE
 		&& render->selection.index < render->scene->sphere_count)
-		render->scene->spheres[render->selection.index].center
-			= vec3_add(render->scene->spheres[render->selection.index].center,
-				move);
-	else if (render->selection.type == OBJ_PLANE
+		return (&render->scene->spheres[render->selection.index].center);
+	if (render->selection.type == OBJ_PLANE
 		&& render->selection.index < render->scene->plane_count)
-		render->scene->planes[render->selection.index].point
-			= vec3_add(render->scene->planes[render->selection.index].point,
-				move);
-	else if (render->selection.type == OBJ_CYLINDER
+		return (&render->scene->planes[render->selection.index].point);
+	if (render->selection.type == OBJ_CYLINDER
 		&& render->selection.index < render->scene->cylinder_count)
-		render->scene->cylinders[render->selection.index].center
-			= vec3_add(render->scene->cylinders[render->selection.index].center,
-				move);
+		return (&render->scene->cylinders[render->selection.index].center);
+	return (NULL);
+}
+
+/*
+** Move the currently selected object by the given delta vector.
+** The screen area of the object and its shadow is damaged before and
+** after the move, and the BVH is rebuilt so traversal sees the new
+** position. The edit generation keeps cached frames of the old scene
+** from matching.
+*/
+/**
+ * @brief move selected object 함수
+ *
+ * @param render 파라미터
+ * @param move 파라미터
+ */
+static void	move_selected_object(t_render *render, t_vec3 move)
+{
+	t_vec3			*position;
+	t_object_ref	ref;
+
+	position = selected_position(render);
+	if (!position)
+		return ;
+	ref.type = render->selection.type;
+	ref.index = render->selection.index;
+	damage_add_object(&render->damage, render->scene, ref);
+	*position = vec3_add(*position, move);
+	render->scene->render_state.edit_generation++;
+	scene_build_bvh(render->scene);
+	damage_add_object(&render->damage, render->scene, ref);
 }
 
 /*
@@ -55,7 +82,7 @@ static void	move_selected_object(t_render *render, t_vec3 move)
 void	handle_object_move(t_render *render, int keycode)
 {
 	t_vec3	move;
-	double	step;
+	t_real	step;
 
 	step = 1.0;
 	move = (t_vec3){0, 0, 0};
@@ -89,7 +116,7 @@ void	handle_object_move(t_render *render, int keycode)
 void	handle_light_move(t_render *render, int keycode)
 {
 	t_vec3	move;
-	double	step;
+	t_real	step;
 
 	step = 1.0;
 	move = (t_vec3){0, 0, 0};
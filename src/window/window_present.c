@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   window_present.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yoshin <yoshin@student.42gyeongsan.kr>     +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/01/23 10:00:00 by yoshin            #+#    #+#             */
+/*   Updated: 2026/01/23 10:00:00 by yoshin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "window.h"
+#include "window_internal.h"
+#include "utils.h"
+
+/*
+** Blend one overlay layer over the scene frame into the view image.
+** Both images share the window size, so they share the row stride.
+*/
+static void	compose_layer(t_render *render, t_overlay *layer)
+{
+	unsigned int	*scene_row;
+	unsigned int	*view_row;
+	int				stride;
+	int				row;
+
+	stride = render->size_line / 4;
+	row = 0;
+	while (row < layer->height)
+	{
+		scene_row = (unsigned int *)render->img_data
+			+ (layer->y + row) * stride + layer->x;
+		view_row = (unsigned int *)render->view_data
+			+ (layer->y + row) * stride + layer->x;
+		overlay_blend_row(view_row, scene_row,
+			layer->pixels + row * layer->width, layer->width);
+		row++;
+	}
+	layer->dirty = 0;
+}
+
+/*
+** Put the current frame on the window.
+** With the HUD hidden the scene image goes out as is. Otherwise the view
+** image (scene + overlay layers) is fully recomposed only when a new
+** scene frame cleared view_valid; a redrawn HUD layer only re-blends its
+** own rectangle. Overlay text lives in the layers, so this is the only
+** call that touches the window.
+*/
+void	render_present(t_render *render)
+{
+	if (!render->hud.visible)
+	{
+		mlx_put_image_to_window(render->mlx, render->win, render->img, 0, 0);
+		return ;
+	}
+	if (!render->view_valid)
+	{
+		ft_memcpy(render->view_data, render->img_data,
+			(size_t)render->size_line * WINDOW_HEIGHT);
+		compose_layer(render, &render->hud.layer);
+		if (render->keyguide.visible)
+			compose_layer(render, &render->keyguide.layer);
+		render->view_valid = 1;
+	}
+	else if (render->hud.layer.dirty)
+		compose_layer(render, &render->hud.layer);
+	mlx_put_image_to_window(render->mlx, render->win,
+		render->view_img, 0, 0);
+}
@@ -14,76 +14,99 @@
 #include "window.h"
 #include "window_internal.h"
 #include "hud.h"
+#include "hud_text.h"
+
+static const int	g_digit_keys[10] = KEY_DIGIT_CODES;
 
 /*
-** Cycle to previous object type when index goes negative.
+** Map a key code to the digit it types, -1 for any other key.
 */
-/**
- * @brief cycle type backward 함수
- *
- * @param render 파라미터
- */
-static void	cycle_type_backward(t_render *render)
+static int	digit_from_key(int keycode)
 {
-	if (render->selection.type == OBJ_SPHERE)
-		cycle_backward_sphere(render);
-	else if (render->selection.type == OBJ_PLANE)
-		cycle_backward_plane(render);
+	int	digit;
+
+	digit = 0;
+	while (digit < 10 && g_digit_keys[digit] != keycode)
+		digit++;
+	if (digit == 10)
+		return (-1);
+	return (digit);
 }
 
 /*
-** Handle selection increment (right bracket key).
+** Look up the typed id ("sp-" + digits) and select it if it exists.
 */
-/**
- * @brief select next object 함수
- *
- * @param render 파라미터
- */
-static void	select_next_object(t_render *render)
+static void	jump_commit(t_render *render)
 {
-	if (render->selection.type == OBJ_NONE)
-		render->selection.type = OBJ_SPHERE;
-	else
-	{
-		render->selection.index++;
-		if ((render->selection.type == OBJ_SPHERE
-				&& render->selection.index >= render->scene->sphere_count)
-			|| (render->selection.type == OBJ_PLANE
-				&& render->selection.index >= render->scene->plane_count)
-			|| (render->selection.type == OBJ_CYLINDER
-				&& render->selection.index >= render->scene->cylinder_count))
-			cycle_type_forward(render);
-	}
+	t_jump_entry	*jump;
+	char			id[16];
+	int				len;
+	int				idx;
+
+	jump = &render->hud.jump;
+	jump->active = 0;
+	len = copy_str_to_buf(id, hud_type_prefix(jump->type));
+	len += copy_str_to_buf(id + len, jump->digits);
+	id[len] = '\0';
+	idx = hud_index_find_id(&render->hud.index, render->scene, id);
+	if (idx >= 0)
+		hud_select_global(render, idx);
 }
 
 /*
-** Handle selection decrement (left bracket key).
+** Start jump-to-id entry (J key). The id prefix follows the current
+** selection; Tab switches it while typing. The HUD is shown so the
+** entry is visible.
 */
-/**
- * @brief select prev object 함수
- *
- * @param render 파라미터
- */
-static void	select_prev_object(t_render *render)
+void	handle_jump_start(t_render *render)
+{
+	t_jump_entry	*jump;
+
+	jump = &render->hud.jump;
+	jump->active = 1;
+	jump->len = 0;
+	jump->digits[0] = '\0';
+	jump->type = render->selection.type;
+	if (jump->type == OBJ_NONE)
+		jump->type = OBJ_SPHERE;
+	render->hud.visible = 1;
+	hud_mark_dirty(render);
+}
+
+/*
+** Consume keys while a jump-to-id entry is open: digits, Backspace,
+** Tab (prefix), Enter (jump), ESC (cancel). Returns 1 if consumed.
+*/
+int	handle_jump_key(t_render *render, int keycode)
 {
-	if (render->selection.type == OBJ_NONE)
-		render->selection.type = OBJ_SPHERE;
-	else
+	t_jump_entry	*jump;
+	int				digit;
+
+	jump = &render->hud.jump;
+	if (!jump->active)
+		return (0);
+	digit = digit_from_key(keycode);
+	if (keycode == KEY_RETURN)
+		jump_commit(render);
+	else if (keycode == KEY_ESC)
+		jump->active = 0;
+	else if (keycode == KEY_TAB)
+		jump->type = jump->type % OBJ_CYLINDER + 1;
+	else if (keycode == KEY_BACKSPACE && jump->len > 0)
+		jump->digits[--jump->len] = '\0';
+	else if (digit >= 0 && jump->len < 6)
 	{
-		render->selection.index--;
-		if (render->selection.index < 0)
-		{
-			if (render->selection.type == OBJ_CYLINDER)
-				cycle_backward_cylinder(render);
-			else
-				cycle_type_backward(render);
-		}
+		jump->digits[jump->len++] = '0' + digit;
+		jump->digits[jump->len] = '\0';
 	}
+	hud_mark_dirty(render);
+	return (1);
 }
 
 /*
 ** Handle object selection with bracket keys.
-** Right bracket: next object, Left bracket: previous object
+** Right bracket: next object, Left bracket: previous object.
+** Both step through the HUD object index like Tab / Shift+Tab.
 */
 /**
  * @brief handle object selection 함수
@@ -93,15 +116,8 @@ static void	select_prev_object(t_render *render)
  */
 void	handle_object_selection(t_render *render, int keycode)
 {
-	int	total;
-
-	total = render->scene->sphere_count + render->scene->plane_count
-		+ render->scene->cylinder_count;
-	if (total == 0)
-		return ;
 	if (keycode == KEY_BRACKET_RIGHT)
-		select_next_object(render);
+		hud_select_next(render);
 	else if (keycode == KEY_BRACKET_LEFT)
-		select_prev_object(render);
-	hud_mark_dirty(render);
+		hud_select_prev(render);
 }
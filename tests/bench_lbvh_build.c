@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_lbvh_build.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: miniRT team <miniRT@42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:00:00 by miniRT           #+#    #+#             */
+/*   Updated: 2026/10/19 00:00:00 by miniRT          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "spatial.h"
+#include "bvh_internal.h"
+#include "window.h"
+#include "metrics.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+** LBVH build benchmark on synthetic spheres (the scene parser caps each
+** object type at 100, so large builds are fed to the build core
+** directly). Usage: tests/bench_lbvh_build [count], default 1000000.
+** Centers and boxes are filled up front, as bvh_build_lbvh does from
+** the scene, and are not timed.
+*/
+
+static unsigned int	next_rand(unsigned int *seed)
+{
+	*seed = *seed * 1664525u + 1013904223u;
+	return (*seed >> 8);
+}
+
+/* Spheres of radius up to 1 scattered in a 1000-unit cube */
+static void	fill_spheres(t_lbvh *l, int count)
+{
+	unsigned int	seed;
+	t_vec3			c;
+	t_real			r;
+	int				i;
+
+	seed = 42;
+	i = 0;
+	while (i < count)
+	{
+		c.x = (t_real)(next_rand(&seed) % 1000000) / 1000;
+		c.y = (t_real)(next_rand(&seed) % 1000000) / 1000;
+		c.z = (t_real)(next_rand(&seed) % 1000000) / 1000;
+		r = (t_real)(next_rand(&seed) % 1000 + 1) / 1000;
+		l->centers[i] = c;
+		l->boxes[i].min = vec3_subtract(c, (t_vec3){r, r, r});
+		l->boxes[i].max = vec3_add(c, (t_vec3){r, r, r});
+		l->refs[i] = (t_object_ref){OBJ_SPHERE, i};
+		i++;
+	}
+}
+
+static int	alloc_state(t_lbvh *l, t_bvh_pool *pool, int count)
+{
+	l->count = count;
+	l->pool = pool;
+	l->refs = malloc(sizeof(t_object_ref) * count);
+	l->centers = malloc(sizeof(t_vec3) * count);
+	l->boxes = malloc(sizeof(t_aabb) * count);
+	l->codes[0] = malloc(sizeof(unsigned int) * count);
+	l->codes[1] = malloc(sizeof(unsigned int) * count);
+	l->order[0] = malloc(sizeof(int) * count);
+	l->order[1] = malloc(sizeof(int) * count);
+	l->left = malloc(sizeof(int) * count);
+	l->right = malloc(sizeof(int) * count);
+	return (l->refs && l->centers && l->boxes && l->codes[0]
+		&& l->codes[1] && l->order[0] && l->order[1] && l->left
+		&& l->right);
+}
+
+/*
+** One build, timed per phase: ms[0] pool reserve, [1] Morton codes,
+** [2] radix sort, [3] hierarchy, [4] node emission, [5] treelets.
+*/
+static void	build_once(t_lbvh *l, double *ms)
+{
+	t_bvh_node	*root;
+	long		t[7];
+	int			id;
+
+	t[0] = get_time_ns();
+	if (!bvh_pool_reserve(l->pool, l->count))
+		exit(1);
+	t[1] = get_time_ns();
+	lbvh_codes(l);
+	t[2] = get_time_ns();
+	lbvh_sort(l);
+	t[3] = get_time_ns();
+	id = lbvh_hierarchy(l);
+	t[4] = get_time_ns();
+	l->depth = 0;
+	root = lbvh_emit(l, id, 0, l->count - 1);
+	t[5] = get_time_ns();
+	bvh_treelet_optimize(root);
+	t[6] = get_time_ns();
+	id = -1;
+	while (++id < 6)
+		ms[id] = (t[id + 1] - t[id]) / 1e6;
+}
+
+static void	print_build(const char *label, double *ms)
+{
+	printf("%-8s reserve %7.1f  codes %6.1f  sort %6.1f  hierarchy %6.1f"
+		"  emit %6.1f  | LBVH %7.1f ms  treelets %7.1f ms\n", label,
+		ms[0], ms[1], ms[2], ms[3], ms[4],
+		ms[0] + ms[1] + ms[2] + ms[3] + ms[4], ms[5]);
+}
+
+int	main(int argc, char **argv)
+{
+	t_lbvh		l;
+	t_bvh_pool	pool;
+	double		ms[6];
+	int			count;
+	int			run;
+
+	count = 1000000;
+	if (argc > 1)
+		count = atoi(argv[1]);
+	pool = (t_bvh_pool){0};
+	if (count < 2 || !alloc_state(&l, &pool, count))
+		return (1);
+	fill_spheres(&l, count);
+	printf("LBVH build, %d synthetic spheres\n", count);
+	build_once(&l, ms);
+	print_build("first", ms);
+	run = 0;
+	while (run++ < 3)
+	{
+		build_once(&l, ms);
+		print_build("rebuild", ms);
+	}
+	bvh_pool_free(&pool);
+	return (0);
+}
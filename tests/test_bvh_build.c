@@ -0,0 +1,196 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_bvh_build.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: miniRT team <miniRT@42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:00:00 by miniRT           #+#    #+#             */
+/*   Updated: 2026/10/19 00:00:00 by miniRT          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "parser.h"
+#include "spatial.h"
+#include "bvh_internal.h"
+#include "utils.h"
+#include "window.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+/*
+** 60 spheres on a grid, 40 long crossing cylinders (where SBVH clips
+** references) and one plane (a huge box for the quantized layout).
+*/
+static void	add_objects(t_scene *scene)
+{
+	char	line[128];
+	int		i;
+
+	i = 0;
+	while (i < 60)
+	{
+		snprintf(line, sizeof(line), "sp %d,%d,%d %d.5 255,0,0",
+			i % 5 * 3, i / 5 % 4 * 3, i / 20 * 3, 1 + i % 2);
+		assert(parse_sphere(line, scene));
+		i++;
+	}
+	i = 0;
+	while (i < 40)
+	{
+		snprintf(line, sizeof(line), "cy %d,1,%d %d,0,%d 0.3 30 0,255,0",
+			i % 8 * 2, i / 8 * 2, i % 2, 1 - i % 2);
+		assert(parse_cylinder(line, scene));
+		i++;
+	}
+	assert(parse_plane("pl 0,-2,0 0,1,0 0,0,255", scene));
+}
+
+/* Leaf references of the binary tree, counted per object */
+static void	count_refs(t_bvh_node *node, int seen[4][OBJECT_SLOTS])
+{
+	int	k;
+
+	if (!node)
+		return ;
+	k = 0;
+	while (k < node->object_count)
+	{
+		seen[node->objects[k].type][node->objects[k].index]++;
+		k++;
+	}
+	count_refs(node->left, seen);
+	count_refs(node->right, seen);
+}
+
+/* Bounds of the objects under slot i of wide node idx */
+static t_aabb	check_wide(t_bvh *bvh, t_scene *scene, int idx);
+
+static t_aabb	slot_objects(t_bvh *bvh, t_scene *scene, int idx, int i)
+{
+	t_bvh_wide	*w;
+	t_aabb		box;
+	int			k;
+
+	w = &bvh->wide[idx];
+	if (w->count[i] == 0)
+		return (check_wide(bvh, scene, w->child[i]));
+	box = get_object_bounds(bvh->wide_refs[w->child[i]], scene);
+	k = 1;
+	while (k < w->count[i])
+	{
+		box = aabb_merge(box, get_object_bounds(
+					bvh->wide_refs[w->child[i] + k], scene));
+		k++;
+	}
+	return (box);
+}
+
+/*
+** Every slot box of wide node idx must contain the objects under it,
+** whether it is stored in full precision or quantized (make QBVH=1).
+** Returns the bounds of the objects under the node.
+*/
+static t_aabb	check_wide(t_bvh *bvh, t_scene *scene, int idx)
+{
+	t_aabb	node_box;
+	t_aabb	box;
+	t_aabb	slot;
+	int		i;
+
+	i = 0;
+	while (i < bvh->wide[idx].n)
+	{
+		box = slot_objects(bvh, scene, idx, i);
+		slot = bvh_wide_box(&bvh->wide[idx], i);
+		assert(slot.min.x <= box.min.x && slot.max.x >= box.max.x);
+		assert(slot.min.y <= box.min.y && slot.max.y >= box.max.y);
+		assert(slot.min.z <= box.min.z && slot.max.z >= box.max.z);
+		if (i == 0)
+			node_box = box;
+		node_box = aabb_merge(node_box, box);
+		i++;
+	}
+	return (node_box);
+}
+
+/*
+** Every object is referenced exactly once, or at least once when spatial
+** splits may duplicate it (dup).
+*/
+static void	check_seen(t_scene *scene, int seen[4][OBJECT_SLOTS], int dup)
+{
+	int	count[4];
+	int	type;
+	int	i;
+
+	count[OBJ_SPHERE] = scene->sphere_count;
+	count[OBJ_PLANE] = scene->plane_count;
+	count[OBJ_CYLINDER] = scene->cylinder_count;
+	type = OBJ_SPHERE;
+	while (type <= OBJ_CYLINDER)
+	{
+		i = 0;
+		while (i < count[type])
+		{
+			assert(seen[type][i] == 1 || (dup && seen[type][i] > 1));
+			i++;
+		}
+		type++;
+	}
+}
+
+/*
+** Build from the node pool, then check the references of the binary
+** tree and the BVH4 / BVH8 child boxes. SBVH leaves hold clipped
+** references, so only their count is checked (SBVH_BUDGET).
+*/
+static void	test_builder(t_scene *scene, int builder, const char *name)
+{
+	static int	seen[4][OBJECT_SLOTS];
+	t_bvh		*bvh;
+	int			n;
+
+	bvh = bvh_create();
+	assert(bvh);
+	bvh->builder = builder;
+	scene->render_state.bvh = bvh;
+	scene_build_bvh(scene);
+	n = scene->sphere_count + scene->plane_count + scene->cylinder_count;
+	assert(bvh->root && bvh->pool.nodes_used <= 2 * n - 1);
+	ft_memset(seen, 0, sizeof(seen));
+	count_refs(bvh->root, seen);
+	check_seen(scene, seen, builder == BVH_BUILD_SBVH);
+	assert(bvh->pool.refs_used == n || (builder == BVH_BUILD_SBVH
+			&& bvh->pool.refs_used <= n + n * SBVH_BUDGET / 100));
+	assert(bvh->wide);
+	if (builder != BVH_BUILD_SBVH)
+		check_wide(bvh, scene, 0);
+	bvh_set_width(bvh, 8);
+	if (builder != BVH_BUILD_SBVH)
+		check_wide(bvh, scene, 0);
+	printf("✓ %s: %d objects, %d references\n", name, n,
+		bvh->pool.refs_used);
+	bvh_destroy(bvh);
+	scene->render_state.bvh = NULL;
+}
+
+int	main(void)
+{
+	t_scene	*scene;
+
+	printf("\n=== BVH Build Unit Tests ===\n\n");
+	scene = calloc(1, sizeof(t_scene));
+	assert(scene);
+	scene->render_state.bvh_enabled = 1;
+	add_objects(scene);
+	test_builder(scene, BVH_BUILD_MEDIAN, "median split");
+	test_builder(scene, BVH_BUILD_LBVH, "LBVH + treelets");
+	test_builder(scene, BVH_BUILD_SBVH, "SBVH");
+	free(scene);
+	printf("\n=== BVH build tests passed! ===\n\n");
+	return (0);
+}
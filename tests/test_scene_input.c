@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_scene_input.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: miniRT team <miniRT@42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:00:00 by miniRT           #+#    #+#             */
+/*   Updated: 2026/10/19 00:00:00 by miniRT          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "parser.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/* Write text to a new temporary file; path receives its name */
+static void	write_temp(const char *text, char *path)
+{
+	int	fd;
+
+	strcpy(path, "/tmp/minirt_test_XXXXXX");
+	fd = mkstemp(path);
+	assert(fd >= 0);
+	assert(write(fd, text, strlen(text)) == (ssize_t)strlen(text));
+	close(fd);
+}
+
+/* Load OBJ text as a mesh; tris receives the triangle count */
+static int	load_obj(const char *text, int *tris)
+{
+	char	path[32];
+	t_mesh	mesh;
+	int		ok;
+
+	write_temp(text, path);
+	ft_memset(&mesh, 0, sizeof(mesh));
+	ok = mesh_load(path, &mesh);
+	*tris = mesh.tri_count;
+	free(mesh.vertices);
+	free(mesh.indices);
+	free(mesh.nodes);
+	unlink(path);
+	return (ok);
+}
+
+/* Parse A, C, L plus body as a scene; instances receives its count */
+static int	parse_text(const char *body, int *instances)
+{
+	char	path[32];
+	char	text[1024];
+	t_scene	*scene;
+	int		ok;
+
+	snprintf(text, sizeof(text), "A 0.2 255,255,255\n"
+		"C 0,0,-10 0,0,1 70\nL 0,10,0 0.7 255,255,255\n%s", body);
+	write_temp(text, path);
+	scene = calloc(1, sizeof(t_scene));
+	assert(scene);
+	scene->shadow_config = init_shadow_config();
+	render_state_init(&scene->render_state);
+	ok = parse_scene(path, scene);
+	*instances = scene->instance_count;
+	cleanup_scene(scene);
+	unlink(path);
+	return (ok);
+}
+
+void	test_obj_faces(void)
+{
+	static const char	*bad[] = {"f 1 2 5\n", "f 0 1 2\n", "f -5 1 2\n",
+		"f 1 2\n", "f 1 2 x\n", "f 1 2 99999999999999999999\n",
+		"v 1 2\n", ""};
+	char				text[256];
+	int					tris;
+	int					i;
+
+	printf("Testing OBJ faces...\n");
+	assert(load_obj("v 0 0 0\nv 1 0 0\nv 0 1 0\nv 1 1 0\n"
+			"f 1 2 4 3\nf -4 -3/1 -2//1\n", &tris) && tris == 3);
+	assert(!load_obj("f 1 2 3\nv 0 0 0\nv 1 0 0\nv 0 1 0\n", &tris));
+	i = -1;
+	while (++i < (int)(sizeof(bad) / sizeof(bad[0])))
+	{
+		snprintf(text, sizeof(text), "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 1 1 0\n"
+			"%s", bad[i]);
+		assert(!load_obj(text, &tris));
+	}
+	printf("✓ OBJ index bounds, negative indices and short faces passed\n");
+}
+
+/* gr / ge / in errors; each case is the scene body after A, C and L */
+void	test_group_instances(void)
+{
+	static const char	*bad[] = {"gr t\nsp 0,0,0 1 9,9,9\n",
+		"ge\nsp 0,0,0 1 9,9,9\n", "gr t\ngr u\nsp 0,0,0 1 9,9,9\nge\nge\n",
+		"gr t\nge\nsp 0,0,0 1 9,9,9\n",
+		"gr t\nsp 0,0,0 1 9,9,9\nge\ngr t\nsp 0,0,0 1 9,9,9\nge\n",
+		"gr\nsp 0,0,0 1 9,9,9\nge\n", "gr t\npl 0,0,0 0,1,0 9,9,9\nge\n",
+		"gr t\nsp 0,0,0 1 9,9,9\nL 0,5,0 0.5 9,9,9\nge\n",
+		"gr t\nsp 0,0,0 1 9,9,9\nC 0,0,0 0,0,1 70\nge\n",
+		"gr t\nsp 0,0,0 1 9,9,9\nge\ngr u\nin t 0,0,0 0,1,0 1\nge\n",
+		"gr t\nsp 0,0,0 1 9,9,9\nmh x.obj 0,0,0 1 9,9,9\nge\n",
+		"gr t\nsp 0,0,0 1 9,9,9\nge\nin u 0,0,0 0,1,0 1\n",
+		"in t 0,0,0 0,1,0 1\ngr t\nsp 0,0,0 1 9,9,9\nge\n",
+		"gr t\nsp 0,0,0 1 9,9,9\nge\nin t 0,0 0,1,0 1\n",
+		"gr t\nsp 0,0,0 1 9,9,9\nge\nin t 0,0,0 0,0,0 1\n",
+		"gr t\nsp 0,0,0 1 9,9,9\nge\nin t 0,0,0 0,1,0 0\n",
+		"gr t\nsp 0,0,0 1 9,9,9\nge\nin t 0,0,0 0,1,0 -2\n"};
+	int					n;
+	int					i;
+
+	printf("Testing gr / ge / in...\n");
+	assert(parse_text("gr t\nsp 0,0,0 1 9,9,9\ncy 0,1,0 0,1,0 0.2 2 9,9,9\n"
+			"ge\nin t 0,0,0 0,1,0 1\nin t 5,0,0 1,0,0 2\n", &n) && n == 2);
+	i = -1;
+	while (++i < (int)(sizeof(bad) / sizeof(bad[0])))
+		assert(!parse_text(bad[i], &n));
+	printf("✓ Unclosed, nested, empty and duplicate groups, members that "
+		"cannot be grouped and bad instances rejected\n");
+}
+
+int	main(void)
+{
+	printf("\n=== Scene Input Unit Tests ===\n\n");
+	test_obj_faces();
+	test_group_instances();
+	printf("\n=== Scene input tests passed! ===\n\n");
+	return (0);
+}